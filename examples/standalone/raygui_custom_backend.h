@@ -52,11 +52,11 @@ static Vector2 GetMousePosition(void)
     return position;
 }
 
-static int GetMouseWheelMove(void)
+static float GetMouseWheelMove(void)
 {
     // TODO: Mouse wheel movement variation, reseted every frame
     
-    return 0;
+    return 0.0f;
 }
 
 static bool IsMouseButtonDown(int button)
@@ -102,6 +102,22 @@ static int GetKeyPressed(void)
     return 0;
 }
 
+// USED IN: GuiTextBox(), key repeat timing
+static float GetFrameTime(void)
+{
+    // TODO: Return time in seconds for last frame drawn (delta time)
+
+    return 0.0f;
+}
+
+// USED IN: GuiTabBar(), GuiTooltip()
+static int GetScreenWidth(void)
+{
+    // TODO: Return current screen width
+
+    return 0;
+}
+
 //-------------------------------------------------------------------------------
 // Drawing required functions
 //-------------------------------------------------------------------------------
@@ -122,6 +138,12 @@ static void DrawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color)
     // TODO: Draw triangle on the screen, required for arrows
 }
 
+// USED IN: GuiDrawText(), GuiDrawIcon()
+static void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint)
+{
+    // TODO: Draw a part of a texture (source) scaled into dest rectangle, required for font glyphs and icons atlas
+}
+
 //-------------------------------------------------------------------------------
 // Text required functions
 //-------------------------------------------------------------------------------
@@ -179,3 +201,29 @@ static const char *GetDirectoryPath(const char *filePath)
     return NULL;
 }
 
+// USED IN: GuiUnloadStyle(), GuiDrawIcon()
+static void UnloadTexture(Texture2D texture)
+{
+    // TODO: Unload texture from GPU memory, required to unload style fonts and regenerate icons atlas
+}
+
+// USED IN: GuiSetStyleSet()
+static Texture2D GetShapesTexture(void)
+{
+    Texture2D texture = { 0 };
+
+    // TODO: Return texture used to draw shapes, kept by style sets
+
+    return texture;
+}
+
+// USED IN: GuiSetStyleSet()
+static Rectangle GetShapesTextureRectangle(void)
+{
+    Rectangle rec = { 0 };
+
+    // TODO: Return texture source rectangle used to draw shapes, kept by style sets
+
+    return rec;
+}
+
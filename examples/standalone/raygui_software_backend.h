@@ -0,0 +1,2312 @@
+/*******************************************************************************************
+*
+*   raygui - Standalone mode software backend
+*
+*   CPU software rasterizer backend for RAYGUI_STANDALONE, no GPU or window system required,
+*   all raygui drawing is rasterized into a caller-owned RGBA8 framebuffer (4 bytes per pixel, rows packed)
+*
+*   FEATURES:
+*       - Rectangles, gradients (GuiColorPicker()) and textured quads (font glyphs, icons atlas) with alpha blending
+*       - Span fill and blend kernels with SSE2/AVX2 or NEON, selected at runtime (RAYGUI_SOFTWARE_NO_SIMD disables them)
+*       - Gradients stepped in fixed point and cached, color panel (with its value overlay) and hue bar
+*         are reused until their colors change
+*       - Optional tiled mode: draw calls recorded, binned into tiles and rasterized by multiple threads (empty tiles skipped),
+*         worker threads are kept waiting between flushes, output is byte-identical to immediate mode
+*         (GuiSoftwareSetThreads(), GuiSoftwareFlush())
+*       - Partial redraw, drawing clipped to damaged rectangles reported by GuiEndFrame() (GuiSoftwareSetDamage())
+*       - Embedded default font (5x7 pixels glyphs, ASCII), used by all styles
+*       - DEFLATE decompression for compressed style bundles (.rgsb)
+*       - Input state provided by the user, so it can be fed from any event source or test script
+*       - GuiRenderToImage() to render a gui frame into an image, for screenshots and tests
+*
+*   USAGE:
+*       #define RAYGUI_IMPLEMENTATION
+*       #define RAYGUI_STANDALONE
+*       #include "raygui.h"
+*       #include "raygui_software_backend.h"
+*
+*       unsigned char *pixels = malloc(width*height*4);
+*       GuiSoftwareSetFramebuffer(pixels, width, height);
+*
+*       // Frame: input state, gui drawing, input update
+*       GuiSoftwareSetMousePosition(position);
+*       GuiSoftwareSetMouseButton(MOUSE_LEFT_BUTTON, down);
+*       GuiSoftwareClear(background);
+*       GuiButton(bounds, "Button");
+*       GuiSoftwareFlush();             // Only required in tiled mode
+*       GuiSoftwareUpdateInput();
+*
+*       // Frame with partial redraw (RAYGUI_COMMAND_LIST), only regions changed since previous frame are redrawn
+*       GuiButton(bounds, "Button");    // Recorded
+*       int count = 0;
+*       const Rectangle *damage = GuiEndFrame(&count);
+*       if (count > 0)
+*       {
+*           GuiSoftwareSetDamage(damage, count);
+*           GuiSoftwareClear(background);
+*           GuiFlush();
+*           GuiSoftwareFlush();
+*       }
+*
+*   LIMITATIONS:
+*       - LoadFontEx() is not supported (no font files rasterizer), default font is returned
+*       - Style fonts are not loaded by raygui in RAYGUI_STANDALONE mode, style properties are loaded
+*       - DrawTexturePro() origin and rotation are not supported, they are not used by raygui
+*       - Textures are sampled with nearest filtering (same as raylib default TEXTURE_FILTER_POINT)
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+**********************************************************************************************/
+
+#ifndef RAYGUI_SOFTWARE_BACKEND_H
+#define RAYGUI_SOFTWARE_BACKEND_H
+
+#if !defined(RAYGUI_STANDALONE)
+    #error "raygui software backend requires RAYGUI_STANDALONE"
+#endif
+
+#include <stdio.h>      // Required for: FILE, fopen(), fseek(), ftell(), fread(), fwrite(), fclose()
+#include <string.h>     // Required for: memcpy(), memset(), strlen(), strrchr()
+
+#if !defined(RAYGUI_SOFTWARE_NO_THREADS)
+    #if defined(_WIN32)
+        #include <process.h>    // Required for: _beginthreadex() [GuiSoftwareSetThreads()]
+        #include <stdint.h>     // Required for: uintptr_t
+
+        #if defined(_WINDOWS_)
+            typedef SRWLOCK GuiSoftwareLock;
+            typedef CONDITION_VARIABLE GuiSoftwareCond;
+        #else
+            // NOTE: windows.h is not included to avoid conflicts with raylib symbols,
+            // lock and condition variable types have the same layout as SRWLOCK and CONDITION_VARIABLE
+            typedef struct GuiSoftwareLock { void *ptr; } GuiSoftwareLock;
+            typedef struct GuiSoftwareCond { void *ptr; } GuiSoftwareCond;
+
+            #if defined(__cplusplus)
+            extern "C" {        // Prevents name mangling of Win32 functions
+            #endif
+            __declspec(dllimport) void __stdcall AcquireSRWLockExclusive(GuiSoftwareLock *lock);
+            __declspec(dllimport) void __stdcall ReleaseSRWLockExclusive(GuiSoftwareLock *lock);
+            __declspec(dllimport) int __stdcall SleepConditionVariableSRW(GuiSoftwareCond *cond, GuiSoftwareLock *lock, unsigned long milliseconds, unsigned long flags);
+            __declspec(dllimport) void __stdcall WakeAllConditionVariable(GuiSoftwareCond *cond);
+            __declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *handle, unsigned long milliseconds);
+            __declspec(dllimport) int __stdcall CloseHandle(void *handle);
+            #if defined(__cplusplus)
+            }
+            #endif
+        #endif
+    #else
+        #include <pthread.h>    // Required for: pthread_create(), pthread_join(), pthread_mutex_t, pthread_cond_t [GuiSoftwareSetThreads()]
+
+        typedef pthread_mutex_t GuiSoftwareLock;
+        typedef pthread_cond_t GuiSoftwareCond;
+    #endif
+#endif
+
+// SIMD kernels: SSE2 is baseline on x86-64, AVX2 is selected at runtime if supported by CPU
+#if !defined(RAYGUI_SOFTWARE_NO_SIMD)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #define RAYGUI_SOFTWARE_SSE2
+        #include <emmintrin.h>      // Required for: SSE2 intrinsics
+        #if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+            #define RAYGUI_SOFTWARE_AVX2
+            #include <immintrin.h>  // Required for: AVX2 intrinsics, functions compiled with target("avx2")
+        #endif
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #define RAYGUI_SOFTWARE_NEON
+        #include <arm_neon.h>       // Required for: NEON intrinsics
+    #endif
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#if !defined(RAYGUI_SOFTWARE_MAX_TEXTURES)
+    #define RAYGUI_SOFTWARE_MAX_TEXTURES     64     // Maximum number of textures loaded (default font, style fonts, icons atlas)
+#endif
+#if !defined(RAYGUI_SOFTWARE_MAX_CHARS)
+    #define RAYGUI_SOFTWARE_MAX_CHARS        16     // Maximum number of chars pressed queued per frame
+#endif
+#if !defined(RAYGUI_SOFTWARE_GRADIENT_CACHE_SIZE)
+    #define RAYGUI_SOFTWARE_GRADIENT_CACHE_SIZE         16      // Maximum number of gradients cached (GuiColorPicker() draws 8)
+#endif
+#if !defined(RAYGUI_SOFTWARE_GRADIENT_CACHE_MAX_PIXELS)
+    #define RAYGUI_SOFTWARE_GRADIENT_CACHE_MAX_PIXELS   (512*512)   // Bigger gradients are not cached, rendered row by row
+#endif
+#if !defined(RAYGUI_SOFTWARE_MAX_THREADS)
+    #define RAYGUI_SOFTWARE_MAX_THREADS      64     // Maximum number of rasterization threads (tiled mode)
+#endif
+#if !defined(RAYGUI_SOFTWARE_TILE_SIZE)
+    #define RAYGUI_SOFTWARE_TILE_SIZE        64     // Tile size in pixels (tiled mode)
+#endif
+#if !defined(RAYGUI_SOFTWARE_MAX_DAMAGE_RECS)
+    #define RAYGUI_SOFTWARE_MAX_DAMAGE_RECS  64     // Maximum number of damaged rectangles, whole framebuffer drawn if exceeded
+#endif
+
+#define RAYGUI_SOFTWARE_MAX_KEYS            512     // Maximum key code supported (raylib KeyboardKey values)
+#define RAYGUI_SOFTWARE_MAX_MOUSE_BUTTONS     3     // Mouse buttons supported: left, right, middle
+
+// Divide by 255 with rounding, exact for x in [0, 255*255], same result in scalar and SIMD kernels
+#define RAYGUI_SOFTWARE_DIV255(x)   ((((x) + 128) + (((x) + 128) >> 8)) >> 8)
+
+// Atomic increment (returns previous value) and load [GuiSoftwareFlush()]
+#if defined(_MSC_VER)
+    #define RAYGUI_SOFTWARE_ATOMIC_ADD(ptr, value)  _InterlockedExchangeAdd((long volatile *)(ptr), (long)(value))
+    #define RAYGUI_SOFTWARE_ATOMIC_LOAD(ptr)        _InterlockedCompareExchange((long volatile *)(ptr), 0, 0)
+#else
+    #define RAYGUI_SOFTWARE_ATOMIC_ADD(ptr, value)  __atomic_fetch_add((ptr), (value), __ATOMIC_ACQ_REL)
+    #define RAYGUI_SOFTWARE_ATOMIC_LOAD(ptr)        __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#endif
+
+// Rasterization workers lock and condition variables [GuiSoftwareFlush()]
+#if !defined(RAYGUI_SOFTWARE_NO_THREADS)
+    #if defined(_WIN32)
+        #define RAYGUI_SOFTWARE_LOCK(lock)          AcquireSRWLockExclusive(lock)
+        #define RAYGUI_SOFTWARE_UNLOCK(lock)        ReleaseSRWLockExclusive(lock)
+        #define RAYGUI_SOFTWARE_WAIT(cond, lock)    SleepConditionVariableSRW((cond), (lock), 0xffffffff, 0)    // INFINITE
+        #define RAYGUI_SOFTWARE_WAKE(cond)          WakeAllConditionVariable(cond)
+    #else
+        #define RAYGUI_SOFTWARE_LOCK(lock)          pthread_mutex_lock(lock)
+        #define RAYGUI_SOFTWARE_UNLOCK(lock)        pthread_mutex_unlock(lock)
+        #define RAYGUI_SOFTWARE_WAIT(cond, lock)    pthread_cond_wait((cond), (lock))
+        #define RAYGUI_SOFTWARE_WAKE(cond)          pthread_cond_broadcast(cond)
+    #endif
+#endif
+
+// Pixel formats supported by LoadTextureFromImage(), same values as raylib PixelFormat
+#define RAYGUI_SOFTWARE_PIXELFORMAT_GRAYSCALE       1
+#define RAYGUI_SOFTWARE_PIXELFORMAT_GRAY_ALPHA      2
+#define RAYGUI_SOFTWARE_PIXELFORMAT_R8G8B8          4
+#define RAYGUI_SOFTWARE_PIXELFORMAT_R8G8B8A8        7
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Software texture, pixels converted to RGBA8 when loaded
+typedef struct GuiSoftwareTexture {
+    unsigned char *pixels;      // Texture pixels (RGBA8), NULL if texture slot is not used
+    int width;                  // Texture width
+    int height;                 // Texture height
+} GuiSoftwareTexture;
+
+// Span kernel, fill or blend count pixels with color
+typedef void (*GuiSoftwareSpanFunc)(unsigned char *dst, int count, Color color);
+
+// Row kernel, blend count source pixels (RGBA8) over destination
+typedef void (*GuiSoftwareRowFunc)(unsigned char *dst, const unsigned char *src, int count);
+
+// Gradient kernel, write count pixels starting at 16.16 fixed point color, incremented by step per pixel
+typedef void (*GuiSoftwareGradientFunc)(unsigned char *dst, int count, const int *start, const int *step);
+
+// Gradient key, gradient pixels only depend on rectangle size, subpixel offset and corner colors
+// NOTE: Fields are 4 bytes aligned, key is compared with memcmp()
+typedef struct GuiSoftwareGradientKey {
+    float width;                // Rectangle width
+    float height;               // Rectangle height
+    float offsetX;              // Rectangle x offset from first pixel covered
+    float offsetY;              // Rectangle y offset from first pixel covered
+    Color colors[4];            // Corner colors: top-left, bottom-left, bottom-right, top-right
+    Color overlay[4];           // Overlay corner colors, blended over gradient (color panel value), zero if no overlay
+} GuiSoftwareGradientKey;
+
+// Gradient cached, rendered pixels (not blended)
+typedef struct GuiSoftwareGradient {
+    GuiSoftwareGradientKey key; // Gradient key
+    unsigned char *pixels;      // Gradient pixels (RGBA8), NULL if cache slot is not used
+    int width;                  // Gradient pixels width
+    int height;                 // Gradient pixels height
+    bool opaque;                // All pixels are opaque, rows are copied
+    unsigned int lastUsed;      // Last use counter, least recently used gradient is replaced
+} GuiSoftwareGradient;
+
+// Draw call type
+typedef enum {
+    GUI_SOFTWARE_OP_CLEAR = 0,      // Framebuffer clear, color written
+    GUI_SOFTWARE_OP_RECTANGLE,      // Rectangle, color blended
+    GUI_SOFTWARE_OP_GRADIENT,       // Gradient rectangle, cached pixels copied or blended
+    GUI_SOFTWARE_OP_TEXTURE         // Texture quad, tinted and blended
+} GuiSoftwareOpType;
+
+// Draw call, rasterized when called (immediate mode) or recorded and rasterized by tiles (tiled mode)
+typedef struct GuiSoftwareOp {
+    int type;                   // Draw call type: GuiSoftwareOpType
+    int posX;                   // Pixels covered, first pixel x (not clipped)
+    int posY;                   // Pixels covered, first pixel y (not clipped)
+    int width;                  // Pixels covered width
+    int height;                 // Pixels covered height
+    int x0;                     // Pixels covered clipped to framebuffer, first pixel x
+    int y0;                     // Pixels covered clipped to framebuffer, first pixel y
+    int x1;                     // Pixels covered clipped to framebuffer, last pixel x (exclusive)
+    int y1;                     // Pixels covered clipped to framebuffer, last pixel y (exclusive)
+    Color color;                // Clear or rectangle color, texture tint
+    unsigned int textureId;     // Texture id
+    Rectangle source;           // Texture source rectangle
+    Rectangle dest;             // Texture destination rectangle
+    const GuiSoftwareGradient *gradient;    // Gradient cached, NULL if gradient is rendered when rasterized
+    GuiSoftwareGradientKey key; // Gradient key
+} GuiSoftwareOp;
+
+// Tile row, draw calls are binned into rows when recorded and into row tiles when flushed (tiled mode)
+// NOTE: Every row is binned by a single thread, rows are binned in parallel
+typedef struct GuiSoftwareTileRow {
+    int *ops;                   // Draw calls indices covering row, in recorded order
+    int opCount;                // Draw calls covering row
+    int opCapacity;             // Draw calls indices capacity
+    int *tileOps;               // Draw calls indices binned per row tile, tile draw calls range in tileOffsets
+    int tileOpsCapacity;        // Row tiles draw calls indices capacity
+    int *tileOffsets;           // First draw call index per row tile, tilesX + 1 values
+    int tileCapacity;           // Row tiles offsets capacity
+} GuiSoftwareTileRow;
+
+// Raster region, drawing is clipped to it, one per rasterization thread
+typedef struct GuiSoftwareRegion {
+    int x0;                     // Region first pixel x
+    int y0;                     // Region first pixel y
+    int x1;                     // Region last pixel x (exclusive)
+    int y1;                     // Region last pixel y (exclusive)
+    unsigned char *row;         // Gradient row pixels, for gradients not cached
+    int rowSize;                // Gradient row pixels capacity
+} GuiSoftwareRegion;
+
+// Software backend state
+typedef struct GuiSoftwareState {
+    unsigned char *pixels;      // Framebuffer pixels (RGBA8), caller owned
+    int width;                  // Framebuffer width
+    int height;                 // Framebuffer height
+    GuiSoftwareSpanFunc fillSpan;   // Opaque span kernel, selected on first use
+    GuiSoftwareSpanFunc blendSpan;  // Translucent span kernel, selected on first use
+    GuiSoftwareRowFunc blendRow;    // Row blend kernel, selected on first use
+    GuiSoftwareGradientFunc gradientSpan;   // Gradient span kernel, selected on first use
+    const char *kernels;        // Span kernels name: "scalar", "SSE2", "AVX2", "NEON"
+
+    GuiSoftwareTexture textures[RAYGUI_SOFTWARE_MAX_TEXTURES];  // Textures loaded, texture id is slot index + 1
+    Font defaultFont;           // Default font, generated on first request
+    Texture2D shapesTexture;    // Shapes texture, kept for raygui style sets (not used for drawing)
+    Rectangle shapesRec;        // Shapes texture source rectangle
+
+    GuiSoftwareGradient gradients[RAYGUI_SOFTWARE_GRADIENT_CACHE_SIZE];    // Gradients cached
+    unsigned int gradientCounter;   // Gradients use counter
+    unsigned int gradientPinned;    // Gradients used after this counter value are referenced by draw calls recorded, not replaced
+    GuiSoftwareGradientKey lastGradient;    // Last opaque gradient drawn, overlay gradient drawn next is cached with it
+    int lastGradientX;              // Last opaque gradient first pixel x
+    int lastGradientY;              // Last opaque gradient first pixel y
+    bool lastGradientValid;         // Last draw call was an opaque gradient
+
+    Vector2 mousePosition;      // Mouse position
+    float mouseWheelMove;       // Mouse wheel movement for current frame
+    bool mouseButtons[RAYGUI_SOFTWARE_MAX_MOUSE_BUTTONS];       // Mouse buttons down state
+    bool prevMouseButtons[RAYGUI_SOFTWARE_MAX_MOUSE_BUTTONS];   // Mouse buttons down state on previous frame
+    bool keys[RAYGUI_SOFTWARE_MAX_KEYS];        // Keys down state
+    bool prevKeys[RAYGUI_SOFTWARE_MAX_KEYS];    // Keys down state on previous frame
+    int chars[RAYGUI_SOFTWARE_MAX_CHARS];       // Chars pressed queue (unicode codepoints)
+    int charCount;              // Chars pressed queued
+    float frameTime;            // Frame time in seconds, used for keys repeat
+
+    int threadCount;            // Rasterization threads, 0 for immediate mode
+    GuiSoftwareRegion regions[RAYGUI_SOFTWARE_MAX_THREADS];     // Raster regions, one per thread, first one used by immediate mode
+    GuiSoftwareOp *ops;         // Draw calls recorded (tiled mode)
+    int opCount;                // Draw calls recorded
+    int opCapacity;             // Draw calls capacity
+    GuiSoftwareTileRow *tileRows;   // Tile rows, draw calls binned per tile
+    int tileRowCapacity;        // Tile rows capacity
+    int tilesX;                 // Tiles per row
+    int tilesY;                 // Tile rows in framebuffer
+    int *tiles;                 // Tiles to rasterize (with draw calls, damaged), filled when rows are binned
+    int tileCount;              // Tiles to rasterize, shared by rasterization threads
+    int tileCapacity;           // Tiles capacity
+    int nextRow;                // Next tile row to bin, shared by rasterization threads
+    int rowsBinned;             // Tile rows binned, tiles are rasterized when all rows are binned
+    int nextTile;               // Next tile to rasterize, shared by rasterization threads
+
+#if !defined(RAYGUI_SOFTWARE_NO_THREADS)
+    // NOTE: Worker threads are started by GuiSoftwareSetThreads() and kept waiting between flushes
+#if defined(_WIN32)
+    void *workers[RAYGUI_SOFTWARE_MAX_THREADS];     // Worker threads handles, first one not used (calling thread)
+#else
+    pthread_t workers[RAYGUI_SOFTWARE_MAX_THREADS]; // Worker threads, first one not used (calling thread)
+#endif
+    int workerCount;            // Worker threads started
+    GuiSoftwareLock workLock;   // Workers state lock
+    GuiSoftwareCond workReady;  // Signaled when a flush is started or workers must exit
+    GuiSoftwareCond workDone;   // Signaled when last worker is done with a flush
+    GuiSoftwareCond workBinned; // Signaled when last tile row is binned
+    int workFlush;              // Flushes started, workers rasterize tiles when it changes
+    int workPending;            // Workers still rasterizing current flush
+    bool workExit;              // Workers must exit
+#endif
+
+    bool damageClip;            // Drawing clipped to damaged rectangles
+    Rectangle damage[RAYGUI_SOFTWARE_MAX_DAMAGE_RECS];  // Damaged rectangles, not overlapping
+    int damageCount;            // Damaged rectangles count
+} GuiSoftwareState;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static GuiSoftwareState guiSoftware = { 0 };
+
+// Default font glyphs data, ASCII 32..126, 5x7 pixels
+// NOTE: One byte per glyph column, bit 0 is the top row
+static const unsigned char guiSoftwareFontData[95*5] = {
+    0x00, 0x00, 0x00, 0x00, 0x00,   0x00, 0x00, 0x5f, 0x00, 0x00,   0x00, 0x07, 0x00, 0x07, 0x00,   0x14, 0x7f, 0x14, 0x7f, 0x14,   //  !"#
+    0x24, 0x2a, 0x7f, 0x2a, 0x12,   0x23, 0x13, 0x08, 0x64, 0x62,   0x36, 0x49, 0x55, 0x22, 0x50,   0x00, 0x05, 0x03, 0x00, 0x00,   // $%&'
+    0x00, 0x1c, 0x22, 0x41, 0x00,   0x00, 0x41, 0x22, 0x1c, 0x00,   0x08, 0x2a, 0x1c, 0x2a, 0x08,   0x08, 0x08, 0x3e, 0x08, 0x08,   // ()*+
+    0x00, 0x50, 0x30, 0x00, 0x00,   0x08, 0x08, 0x08, 0x08, 0x08,   0x00, 0x60, 0x60, 0x00, 0x00,   0x20, 0x10, 0x08, 0x04, 0x02,   // ,-./
+    0x3e, 0x51, 0x49, 0x45, 0x3e,   0x00, 0x42, 0x7f, 0x40, 0x00,   0x42, 0x61, 0x51, 0x49, 0x46,   0x21, 0x41, 0x45, 0x4b, 0x31,   // 0123
+    0x18, 0x14, 0x12, 0x7f, 0x10,   0x27, 0x45, 0x45, 0x45, 0x39,   0x3c, 0x4a, 0x49, 0x49, 0x30,   0x01, 0x71, 0x09, 0x05, 0x03,   // 4567
+    0x36, 0x49, 0x49, 0x49, 0x36,   0x06, 0x49, 0x49, 0x29, 0x1e,   0x00, 0x36, 0x36, 0x00, 0x00,   0x00, 0x56, 0x36, 0x00, 0x00,   // 89:;
+    0x08, 0x14, 0x22, 0x41, 0x00,   0x14, 0x14, 0x14, 0x14, 0x14,   0x00, 0x41, 0x22, 0x14, 0x08,   0x02, 0x01, 0x51, 0x09, 0x06,   // <=>?
+    0x32, 0x49, 0x79, 0x41, 0x3e,   0x7e, 0x11, 0x11, 0x11, 0x7e,   0x7f, 0x49, 0x49, 0x49, 0x36,   0x3e, 0x41, 0x41, 0x41, 0x22,   // @ABC
+    0x7f, 0x41, 0x41, 0x22, 0x1c,   0x7f, 0x49, 0x49, 0x49, 0x41,   0x7f, 0x09, 0x09, 0x09, 0x01,   0x3e, 0x41, 0x49, 0x49, 0x7a,   // DEFG
+    0x7f, 0x08, 0x08, 0x08, 0x7f,   0x00, 0x41, 0x7f, 0x41, 0x00,   0x20, 0x40, 0x41, 0x3f, 0x01,   0x7f, 0x08, 0x14, 0x22, 0x41,   // HIJK
+    0x7f, 0x40, 0x40, 0x40, 0x40,   0x7f, 0x02, 0x0c, 0x02, 0x7f,   0x7f, 0x04, 0x08, 0x10, 0x7f,   0x3e, 0x41, 0x41, 0x41, 0x3e,   // LMNO
+    0x7f, 0x09, 0x09, 0x09, 0x06,   0x3e, 0x41, 0x51, 0x21, 0x5e,   0x7f, 0x09, 0x19, 0x29, 0x46,   0x46, 0x49, 0x49, 0x49, 0x31,   // PQRS
+    0x01, 0x01, 0x7f, 0x01, 0x01,   0x3f, 0x40, 0x40, 0x40, 0x3f,   0x1f, 0x20, 0x40, 0x20, 0x1f,   0x3f, 0x40, 0x38, 0x40, 0x3f,   // TUVW
+    0x63, 0x14, 0x08, 0x14, 0x63,   0x07, 0x08, 0x70, 0x08, 0x07,   0x61, 0x51, 0x49, 0x45, 0x43,   0x00, 0x7f, 0x41, 0x41, 0x00,   // XYZ[
+    0x02, 0x04, 0x08, 0x10, 0x20,   0x00, 0x41, 0x41, 0x7f, 0x00,   0x04, 0x02, 0x01, 0x02, 0x04,   0x40, 0x40, 0x40, 0x40, 0x40,   // \]^_
+    0x00, 0x01, 0x02, 0x04, 0x00,   0x20, 0x54, 0x54, 0x54, 0x78,   0x7f, 0x48, 0x44, 0x44, 0x38,   0x38, 0x44, 0x44, 0x44, 0x20,   // `abc
+    0x38, 0x44, 0x44, 0x48, 0x7f,   0x38, 0x54, 0x54, 0x54, 0x18,   0x08, 0x7e, 0x09, 0x01, 0x02,   0x0c, 0x52, 0x52, 0x52, 0x3e,   // defg
+    0x7f, 0x08, 0x04, 0x04, 0x78,   0x00, 0x44, 0x7d, 0x40, 0x00,   0x20, 0x40, 0x44, 0x3d, 0x00,   0x7f, 0x10, 0x28, 0x44, 0x00,   // hijk
+    0x00, 0x41, 0x7f, 0x40, 0x00,   0x7c, 0x04, 0x18, 0x04, 0x78,   0x7c, 0x08, 0x04, 0x04, 0x78,   0x38, 0x44, 0x44, 0x44, 0x38,   // lmno
+    0x7c, 0x14, 0x14, 0x14, 0x08,   0x08, 0x14, 0x14, 0x18, 0x7c,   0x7c, 0x08, 0x04, 0x04, 0x08,   0x48, 0x54, 0x54, 0x54, 0x20,   // pqrs
+    0x04, 0x3f, 0x44, 0x40, 0x20,   0x3c, 0x40, 0x40, 0x20, 0x7c,   0x1c, 0x20, 0x40, 0x20, 0x1c,   0x3c, 0x40, 0x30, 0x40, 0x3c,   // tuvw
+    0x44, 0x28, 0x10, 0x28, 0x44,   0x0c, 0x50, 0x50, 0x50, 0x3c,   0x44, 0x64, 0x54, 0x4c, 0x44,   0x00, 0x08, 0x36, 0x41, 0x00,   // xyz{
+    0x00, 0x00, 0x7f, 0x00, 0x00,   0x00, 0x41, 0x36, 0x08, 0x00,   0x08, 0x04, 0x08, 0x10, 0x08                                    // |}~
+};
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+void GuiSoftwareSetFramebuffer(unsigned char *pixels, int width, int height);  // Set framebuffer to draw into, RGBA8 pixels owned by caller
+void GuiSoftwareClear(Color color);                             // Clear framebuffer with color (no blending)
+void GuiRenderToImage(Image *image, Color background, void (*drawGui)(void)); // Render gui into RGBA8 image, previous framebuffer restored
+bool GuiSoftwareExportImage(Image image, const char *fileName); // Export RGBA8 image as binary PPM file (.ppm), alpha is discarded
+void GuiSoftwareClose(void);                                    // Unload all textures loaded by backend (including default font), worker threads stopped
+const char *GuiSoftwareGetKernels(void);                        // Get span kernels in use: "scalar", "SSE2", "AVX2", "NEON"
+void GuiSoftwareSetThreads(int count);                          // Set rasterization threads, tiled mode if count > 0, immediate mode if 0 (default)
+void GuiSoftwareFlush(void);                                    // Rasterize draw calls recorded (tiled mode), call once per frame after gui drawing
+void GuiSoftwareSetDamage(const Rectangle *recs, int count);    // Set damaged rectangles, drawing clipped to them, NULL to draw whole framebuffer
+
+void GuiSoftwareSetMousePosition(Vector2 position);             // Set mouse position
+void GuiSoftwareSetMouseButton(int button, bool down);          // Set mouse button state
+void GuiSoftwareSetMouseWheel(float move);                      // Set mouse wheel movement for current frame
+void GuiSoftwareSetKey(int key, bool down);                     // Set key state
+void GuiSoftwareAddChar(int codepoint);                         // Add char pressed for current frame (text input)
+void GuiSoftwareSetFrameTime(float time);                       // Set frame time in seconds (keys repeat)
+void GuiSoftwareUpdateInput(void);                              // Update input state, call once per frame after gui drawing
+
+static void GuiSoftwareFillSpan(unsigned char *dst, int count, Color color);   // Fill framebuffer span with color, alpha blended
+static void GuiSoftwareBlendPixel(unsigned char *dst, Color color);             // Blend color over framebuffer pixel
+static void GuiSoftwareLoadKernels(void);                       // Select span kernels supported by CPU
+static void GuiSoftwareRenderGradient(unsigned char *pixels, const GuiSoftwareGradientKey *key, int columnStart, int columnCount, int rowStart, int rowCount);   // Render gradient pixels
+static GuiSoftwareGradient *GuiSoftwareGetGradient(const GuiSoftwareGradientKey *key, int width, int height);   // Get gradient from cache, rendered if required
+static unsigned char *GuiSoftwareGetRegionRow(GuiSoftwareRegion *region, int width);   // Get region gradient row pixels, grown as required
+static void GuiSoftwareDraw(GuiSoftwareOp *op);                 // Draw call, rasterized or recorded (tiled mode)
+static void GuiSoftwareRasterOp(GuiSoftwareRegion *region, const GuiSoftwareOp *op);  // Rasterize draw call clipped to region
+static void GuiSoftwareResetTiles(void);                        // Reset tile rows for framebuffer size, draw calls binned are discarded
+static void GuiSoftwareBinTiles(void);                          // Bin draw calls into row tiles until all rows are taken, wait for all rows binned
+static void GuiSoftwareRasterTiles(GuiSoftwareRegion *region);  // Rasterize tiles until all tiles are taken
+static void GuiSoftwareStartWorkers(int count);                 // Start rasterization worker threads, waiting for flushes
+static void GuiSoftwareStopWorkers(void);                       // Stop rasterization worker threads
+static bool GuiSoftwareSetRegion(GuiSoftwareRegion *region, int x0, int y0, int x1, int y1, int damage);  // Set region to area clipped to damaged rectangle
+static int GuiSoftwareGetGlyphIndex(Font font, int codepoint);  // Get font glyph index for codepoint, '?' glyph if not found
+static unsigned char *GuiSoftwareInflate(const unsigned char *data, int dataSize, int *outputSize);   // Decompress raw DEFLATE data
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Framebuffer
+//----------------------------------------------------------------------------------
+// Set framebuffer to draw into, RGBA8 pixels owned by caller
+void GuiSoftwareSetFramebuffer(unsigned char *pixels, int width, int height)
+{
+    GuiSoftwareFlush();
+
+    guiSoftware.pixels = pixels;
+    guiSoftware.lastGradientValid = false;
+    guiSoftware.width = (pixels != NULL)? width : 0;
+    guiSoftware.height = (pixels != NULL)? height : 0;
+}
+
+// Clear framebuffer with color
+// NOTE: Color is written, not blended
+void GuiSoftwareClear(Color color)
+{
+    if ((guiSoftware.width <= 0) || (guiSoftware.height <= 0)) return;
+
+    guiSoftware.lastGradientValid = false;
+
+    GuiSoftwareOp op = { 0 };
+    op.type = GUI_SOFTWARE_OP_CLEAR;
+    op.width = guiSoftware.width;
+    op.height = guiSoftware.height;
+    op.color = color;
+
+    GuiSoftwareDraw(&op);
+}
+
+// Render gui into RGBA8 image, image must be allocated by caller
+// NOTE: Draw commands recorded are flushed (RAYGUI_COMMAND_LIST), previous framebuffer is restored
+void GuiRenderToImage(Image *image, Color background, void (*drawGui)(void))
+{
+    if ((image == NULL) || (image->data == NULL) || (image->format != RAYGUI_SOFTWARE_PIXELFORMAT_R8G8B8A8)) return;
+
+    unsigned char *previousPixels = guiSoftware.pixels;
+    int previousWidth = guiSoftware.width;
+    int previousHeight = guiSoftware.height;
+    bool previousDamageClip = guiSoftware.damageClip;
+
+    GuiSoftwareSetFramebuffer((unsigned char *)image->data, image->width, image->height);
+    guiSoftware.damageClip = false;
+    GuiSoftwareClear(background);
+
+    if (drawGui != NULL) drawGui();
+    GuiFlush();
+    GuiSoftwareFlush();
+
+    guiSoftware.pixels = previousPixels;
+    guiSoftware.width = previousWidth;
+    guiSoftware.height = previousHeight;
+    guiSoftware.damageClip = previousDamageClip;
+}
+
+// Export RGBA8 image as binary PPM file (.ppm)
+// NOTE: Alpha channel is discarded
+bool GuiSoftwareExportImage(Image image, const char *fileName)
+{
+    if ((image.data == NULL) || (image.format != RAYGUI_SOFTWARE_PIXELFORMAT_R8G8B8A8)) return false;
+
+    FILE *ppmFile = fopen(fileName, "wb");
+
+    if (ppmFile == NULL) return false;
+
+    fprintf(ppmFile, "P6\n%i %i\n255\n", image.width, image.height);
+
+    const unsigned char *pixels = (const unsigned char *)image.data;
+
+    for (int i = 0; i < image.width*image.height; i++) fwrite(pixels + i*4, 1, 3, ppmFile);
+
+    fclose(ppmFile);
+
+    return true;
+}
+
+// Unload all textures loaded by backend
+// NOTE: Rasterization worker threads are stopped, immediate mode is set
+void GuiSoftwareClose(void)
+{
+    GuiSoftwareFlush();
+    GuiSoftwareStopWorkers();
+    guiSoftware.threadCount = 0;
+
+    for (int i = 0; i < RAYGUI_SOFTWARE_MAX_TEXTURES; i++)
+    {
+        if (guiSoftware.textures[i].pixels != NULL) UnloadTexture(RAYGUI_CLITERAL(Texture2D){ (unsigned int)(i + 1), 0, 0, 1, 0 });
+    }
+
+    RAYGUI_FREE(guiSoftware.defaultFont.recs);
+    RAYGUI_FREE(guiSoftware.defaultFont.glyphs);
+    memset(&guiSoftware.defaultFont, 0, sizeof(Font));
+
+    for (int i = 0; i < RAYGUI_SOFTWARE_GRADIENT_CACHE_SIZE; i++) RAYGUI_FREE(guiSoftware.gradients[i].pixels);
+    memset(guiSoftware.gradients, 0, sizeof(guiSoftware.gradients));
+
+    for (int i = 0; i < RAYGUI_SOFTWARE_MAX_THREADS; i++) RAYGUI_FREE(guiSoftware.regions[i].row);
+    memset(guiSoftware.regions, 0, sizeof(guiSoftware.regions));
+
+    for (int i = 0; i < guiSoftware.tileRowCapacity; i++)
+    {
+        RAYGUI_FREE(guiSoftware.tileRows[i].ops);
+        RAYGUI_FREE(guiSoftware.tileRows[i].tileOps);
+        RAYGUI_FREE(guiSoftware.tileRows[i].tileOffsets);
+    }
+
+    RAYGUI_FREE(guiSoftware.ops);
+    RAYGUI_FREE(guiSoftware.tileRows);
+    RAYGUI_FREE(guiSoftware.tiles);
+    guiSoftware.ops = NULL;
+    guiSoftware.tileRows = NULL;
+    guiSoftware.tiles = NULL;
+    guiSoftware.opCapacity = 0;
+    guiSoftware.tileRowCapacity = 0;
+    guiSoftware.tileCapacity = 0;
+}
+
+// Get span kernels in use
+const char *GuiSoftwareGetKernels(void)
+{
+    if (guiSoftware.fillSpan == NULL) GuiSoftwareLoadKernels();
+
+    return guiSoftware.kernels;
+}
+
+// Set rasterization threads
+// NOTE: With count > 0 (tiled mode) draw calls are recorded, GuiSoftwareFlush() bins them into tiles
+// and rasterizes tiles in parallel, output is byte-identical to immediate mode (count = 0),
+// count - 1 worker threads are started here and kept until threads count changes or GuiSoftwareClose()
+void GuiSoftwareSetThreads(int count)
+{
+    GuiSoftwareFlush();
+
+    count = (count < 0)? 0 : ((count > RAYGUI_SOFTWARE_MAX_THREADS)? RAYGUI_SOFTWARE_MAX_THREADS : count);
+
+    if (count == guiSoftware.threadCount) return;
+
+    GuiSoftwareStopWorkers();
+    guiSoftware.threadCount = count;
+    GuiSoftwareStartWorkers(count - 1);
+}
+
+#if !defined(RAYGUI_SOFTWARE_NO_THREADS)
+// Rasterization worker thread
+// NOTE: Worker waits for flushes started by GuiSoftwareFlush(), tile rows are taken from shared nextRow counter
+// and binned, when all rows are binned, tiles are taken from shared nextTile counter
+static void GuiSoftwareRasterWorker(GuiSoftwareRegion *region)
+{
+    int flush = 0;
+
+    RAYGUI_SOFTWARE_LOCK(&guiSoftware.workLock);
+
+    for (;;)
+    {
+        while (!guiSoftware.workExit && (guiSoftware.workFlush == flush)) RAYGUI_SOFTWARE_WAIT(&guiSoftware.workReady, &guiSoftware.workLock);
+
+        if (guiSoftware.workExit) break;
+
+        flush = guiSoftware.workFlush;
+
+        RAYGUI_SOFTWARE_UNLOCK(&guiSoftware.workLock);
+        GuiSoftwareBinTiles();
+        GuiSoftwareRasterTiles(region);
+        RAYGUI_SOFTWARE_LOCK(&guiSoftware.workLock);
+
+        guiSoftware.workPending--;
+        if (guiSoftware.workPending == 0) RAYGUI_SOFTWARE_WAKE(&guiSoftware.workDone);
+    }
+
+    RAYGUI_SOFTWARE_UNLOCK(&guiSoftware.workLock);
+}
+
+// Rasterization worker thread entry point
+#if defined(_WIN32)
+static unsigned int __stdcall GuiSoftwareRasterThread(void *parameter) { GuiSoftwareRasterWorker((GuiSoftwareRegion *)parameter); return 0; }
+#else
+static void *GuiSoftwareRasterThread(void *parameter) { GuiSoftwareRasterWorker((GuiSoftwareRegion *)parameter); return NULL; }
+#endif
+#endif
+
+// Start rasterization worker threads
+// NOTE: Workers use regions 1..count, region 0 is used by calling thread,
+// threads failing to start are not required, calling thread rasterizes all tiles not taken
+static void GuiSoftwareStartWorkers(int count)
+{
+#if !defined(RAYGUI_SOFTWARE_NO_THREADS)
+    if (count <= 0) return;
+
+    #if !defined(_WIN32)
+    pthread_mutex_init(&guiSoftware.workLock, NULL);
+    pthread_cond_init(&guiSoftware.workReady, NULL);
+    pthread_cond_init(&guiSoftware.workDone, NULL);
+    pthread_cond_init(&guiSoftware.workBinned, NULL);
+    #endif
+
+    guiSoftware.workFlush = 0;
+    guiSoftware.workPending = 0;
+    guiSoftware.workExit = false;
+    guiSoftware.workerCount = 0;
+
+    for (int i = 1; i <= count; i++)
+    {
+    #if defined(_WIN32)
+        uintptr_t thread = _beginthreadex(NULL, 0, GuiSoftwareRasterThread, &guiSoftware.regions[i], 0, NULL);
+        if (thread == 0) break;
+        guiSoftware.workers[i] = (void *)thread;
+    #else
+        if (pthread_create(&guiSoftware.workers[i], NULL, GuiSoftwareRasterThread, &guiSoftware.regions[i]) != 0) break;
+    #endif
+        guiSoftware.workerCount++;
+    }
+
+    #if !defined(_WIN32)
+    // Synchronization objects are only kept while workers are running
+    if (guiSoftware.workerCount == 0)
+    {
+        pthread_mutex_destroy(&guiSoftware.workLock);
+        pthread_cond_destroy(&guiSoftware.workReady);
+        pthread_cond_destroy(&guiSoftware.workDone);
+        pthread_cond_destroy(&guiSoftware.workBinned);
+    }
+    #endif
+#else
+    (void)count;
+#endif
+}
+
+// Stop rasterization worker threads
+static void GuiSoftwareStopWorkers(void)
+{
+#if !defined(RAYGUI_SOFTWARE_NO_THREADS)
+    if (guiSoftware.workerCount == 0) return;
+
+    RAYGUI_SOFTWARE_LOCK(&guiSoftware.workLock);
+    guiSoftware.workExit = true;
+    RAYGUI_SOFTWARE_WAKE(&guiSoftware.workReady);
+    RAYGUI_SOFTWARE_UNLOCK(&guiSoftware.workLock);
+
+    for (int i = 1; i <= guiSoftware.workerCount; i++)
+    {
+    #if defined(_WIN32)
+        WaitForSingleObject(guiSoftware.workers[i], 0xffffffff);   // INFINITE
+        CloseHandle(guiSoftware.workers[i]);
+    #else
+        pthread_join(guiSoftware.workers[i], NULL);
+    #endif
+    }
+
+    #if !defined(_WIN32)
+    pthread_mutex_destroy(&guiSoftware.workLock);
+    pthread_cond_destroy(&guiSoftware.workReady);
+    pthread_cond_destroy(&guiSoftware.workDone);
+    pthread_cond_destroy(&guiSoftware.workBinned);
+    #endif
+
+    guiSoftware.workerCount = 0;
+#endif
+}
+
+// Set damaged rectangles, drawing clipped to them, NULL to draw whole framebuffer
+// NOTE: Rectangles must not overlap (as returned by GuiEndFrame()), pixels inside several ones would be blended
+// more than once, if there are more than RAYGUI_SOFTWARE_MAX_DAMAGE_RECS rectangles whole framebuffer is drawn
+void GuiSoftwareSetDamage(const Rectangle *recs, int count)
+{
+    GuiSoftwareFlush();
+
+    guiSoftware.damageClip = (recs != NULL) && (count <= RAYGUI_SOFTWARE_MAX_DAMAGE_RECS);
+    guiSoftware.damageCount = 0;
+
+    if (guiSoftware.damageClip && (count > 0))
+    {
+        memcpy(guiSoftware.damage, recs, count*sizeof(Rectangle));
+        guiSoftware.damageCount = count;
+    }
+}
+
+// Rasterize draw calls recorded (tiled mode)
+// NOTE: Draw calls are binned into tile rows when recorded, waiting worker threads are woken up and bin rows into tiles,
+// keeping draw calls order, and then rasterize tiles with draw calls, every tile is rasterized by a single thread,
+// calling thread bins rows and rasterizes tiles too
+void GuiSoftwareFlush(void)
+{
+    if (guiSoftware.opCount == 0) return;
+
+    guiSoftware.nextRow = 0;
+    guiSoftware.rowsBinned = 0;
+    guiSoftware.tileCount = 0;
+    guiSoftware.nextTile = 0;
+
+#if !defined(RAYGUI_SOFTWARE_NO_THREADS)
+    // Workers are only woken up if there are more tiles than the calling thread would take
+    bool workers = (guiSoftware.workerCount > 0) && ((guiSoftware.tilesX*guiSoftware.tilesY) > 1);
+
+    if (workers)
+    {
+        RAYGUI_SOFTWARE_LOCK(&guiSoftware.workLock);
+        guiSoftware.workPending = guiSoftware.workerCount;
+        guiSoftware.workFlush++;
+        RAYGUI_SOFTWARE_WAKE(&guiSoftware.workReady);
+        RAYGUI_SOFTWARE_UNLOCK(&guiSoftware.workLock);
+    }
+#endif
+
+    // Rows and tiles not taken by worker threads are binned and rasterized here
+    GuiSoftwareBinTiles();
+    GuiSoftwareRasterTiles(&guiSoftware.regions[0]);
+
+#if !defined(RAYGUI_SOFTWARE_NO_THREADS)
+    if (workers)
+    {
+        RAYGUI_SOFTWARE_LOCK(&guiSoftware.workLock);
+        while (guiSoftware.workPending > 0) RAYGUI_SOFTWARE_WAIT(&guiSoftware.workDone, &guiSoftware.workLock);
+        RAYGUI_SOFTWARE_UNLOCK(&guiSoftware.workLock);
+    }
+#endif
+
+    guiSoftware.opCount = 0;
+    guiSoftware.gradientPinned = guiSoftware.gradientCounter;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Input
+//----------------------------------------------------------------------------------
+// Set mouse position
+void GuiSoftwareSetMousePosition(Vector2 position) { guiSoftware.mousePosition = position; }
+
+// Set mouse button state
+void GuiSoftwareSetMouseButton(int button, bool down)
+{
+    if ((button >= 0) && (button < RAYGUI_SOFTWARE_MAX_MOUSE_BUTTONS)) guiSoftware.mouseButtons[button] = down;
+}
+
+// Set mouse wheel movement for current frame
+void GuiSoftwareSetMouseWheel(float move) { guiSoftware.mouseWheelMove = move; }
+
+// Set key state
+void GuiSoftwareSetKey(int key, bool down)
+{
+    if ((key >= 0) && (key < RAYGUI_SOFTWARE_MAX_KEYS)) guiSoftware.keys[key] = down;
+}
+
+// Add char pressed for current frame
+void GuiSoftwareAddChar(int codepoint)
+{
+    if (guiSoftware.charCount < RAYGUI_SOFTWARE_MAX_CHARS) guiSoftware.chars[guiSoftware.charCount++] = codepoint;
+}
+
+// Set frame time in seconds
+void GuiSoftwareSetFrameTime(float time) { guiSoftware.frameTime = time; }
+
+// Update input state, call once per frame after gui drawing
+// NOTE: Buttons and keys states are kept, pressed/released events are detected against them next frame
+void GuiSoftwareUpdateInput(void)
+{
+    memcpy(guiSoftware.prevMouseButtons, guiSoftware.mouseButtons, sizeof(guiSoftware.mouseButtons));
+    memcpy(guiSoftware.prevKeys, guiSoftware.keys, sizeof(guiSoftware.keys));
+    guiSoftware.mouseWheelMove = 0.0f;
+    guiSoftware.charCount = 0;
+}
+
+//-------------------------------------------------------------------------------
+// Input required functions
+//-------------------------------------------------------------------------------
+static Vector2 GetMousePosition(void) { return guiSoftware.mousePosition; }
+static float GetMouseWheelMove(void) { return guiSoftware.mouseWheelMove; }
+
+static bool IsMouseButtonDown(int button)
+{
+    return ((button >= 0) && (button < RAYGUI_SOFTWARE_MAX_MOUSE_BUTTONS) && guiSoftware.mouseButtons[button]);
+}
+
+static bool IsMouseButtonPressed(int button)
+{
+    return (IsMouseButtonDown(button) && !guiSoftware.prevMouseButtons[button]);
+}
+
+static bool IsMouseButtonReleased(int button)
+{
+    return ((button >= 0) && (button < RAYGUI_SOFTWARE_MAX_MOUSE_BUTTONS) && !guiSoftware.mouseButtons[button] && guiSoftware.prevMouseButtons[button]);
+}
+
+static bool IsKeyDown(int key)
+{
+    return ((key >= 0) && (key < RAYGUI_SOFTWARE_MAX_KEYS) && guiSoftware.keys[key]);
+}
+
+static bool IsKeyPressed(int key)
+{
+    return (IsKeyDown(key) && !guiSoftware.prevKeys[key]);
+}
+
+// Get next char pressed in the frame, 0 if queue is empty
+static int GetCharPressed(void)
+{
+    int codepoint = 0;
+
+    if (guiSoftware.charCount > 0)
+    {
+        codepoint = guiSoftware.chars[0];
+        guiSoftware.charCount--;
+        memmove(guiSoftware.chars, guiSoftware.chars + 1, guiSoftware.charCount*sizeof(int));
+    }
+
+    return codepoint;
+}
+
+static float GetFrameTime(void) { return (guiSoftware.frameTime > 0.0f)? guiSoftware.frameTime : 1.0f/60.0f; }
+static int GetScreenWidth(void) { return guiSoftware.width; }
+
+//-------------------------------------------------------------------------------
+// Drawing required functions
+//-------------------------------------------------------------------------------
+// Draw rectangle, alpha blended
+static void DrawRectangle(int x, int y, int width, int height, Color color)
+{
+    if ((color.a == 0) || (width <= 0) || (height <= 0)) return;
+
+    guiSoftware.lastGradientValid = false;
+
+    GuiSoftwareOp op = { 0 };
+    op.type = GUI_SOFTWARE_OP_RECTANGLE;
+    op.posX = x;
+    op.posY = y;
+    op.width = width;
+    op.height = height;
+    op.color = color;
+
+    GuiSoftwareDraw(&op);
+}
+
+// Draw rectangle with gradients, colors: top-left, bottom-left, bottom-right, top-right
+// NOTE: Colors are interpolated bilinearly at pixel centers, gradient pixels are cached,
+// so gradients drawn every frame with same size and colors (color panel, hue bar) are only blended
+static void DrawRectangleGradientEx(Rectangle rec, Color col1, Color col2, Color col3, Color col4)
+{
+    if ((rec.width <= 0) || (rec.height <= 0)) return;
+
+    if (guiSoftware.blendRow == NULL) GuiSoftwareLoadKernels();
+
+    // Pixels covered by rectangle, pixel centers inside rectangle
+    GuiSoftwareOp op = { 0 };
+    op.type = GUI_SOFTWARE_OP_GRADIENT;
+    op.posX = (int)floorf(rec.x + 0.5f);
+    op.posY = (int)floorf(rec.y + 0.5f);
+    op.width = (int)floorf(rec.x + rec.width + 0.5f) - op.posX;
+    op.height = (int)floorf(rec.y + rec.height + 0.5f) - op.posY;
+
+    if ((op.width <= 0) || (op.height <= 0)) return;
+
+    GuiSoftwareGradientKey *key = &op.key;
+    key->width = rec.width;
+    key->height = rec.height;
+    key->offsetX = rec.x - (float)op.posX;
+    key->offsetY = rec.y - (float)op.posY;
+    key->colors[0] = col1;
+    key->colors[1] = col2;
+    key->colors[2] = col3;
+    key->colors[3] = col4;
+
+    bool cacheable = ((op.width*op.height) <= RAYGUI_SOFTWARE_GRADIENT_CACHE_MAX_PIXELS);
+    bool opaque = (col1.a == 255) && (col2.a == 255) && (col3.a == 255) && (col4.a == 255);
+    bool composite = false;
+
+    // Translucent gradient drawn right over previous opaque gradient (GuiColorPanel() value overlay),
+    // both are cached together, previous gradient pixels are replaced by the composition
+    if (cacheable && !opaque && guiSoftware.lastGradientValid && (guiSoftware.lastGradientX == op.posX) && (guiSoftware.lastGradientY == op.posY) &&
+        (guiSoftware.lastGradient.width == key->width) && (guiSoftware.lastGradient.height == key->height) &&
+        (guiSoftware.lastGradient.offsetX == key->offsetX) && (guiSoftware.lastGradient.offsetY == key->offsetY))
+    {
+        memcpy(key->overlay, key->colors, sizeof(key->overlay));
+        memcpy(key->colors, guiSoftware.lastGradient.colors, sizeof(key->colors));
+        composite = true;
+    }
+
+    guiSoftware.lastGradientValid = cacheable && opaque;
+    if (guiSoftware.lastGradientValid)
+    {
+        guiSoftware.lastGradient = *key;
+        guiSoftware.lastGradientX = op.posX;
+        guiSoftware.lastGradientY = op.posY;
+    }
+
+    if (cacheable) op.gradient = GuiSoftwareGetGradient(key, op.width, op.height);
+
+    // Composition not cached (all gradients in use by draw calls recorded), overlay blended over previous gradient
+    if ((op.gradient == NULL) && composite)
+    {
+        memcpy(key->colors, key->overlay, sizeof(key->colors));
+        memset(key->overlay, 0, sizeof(key->overlay));
+    }
+
+    GuiSoftwareDraw(&op);
+}
+
+// Draw texture quad, source rectangle scaled to destination, tinted and alpha blended
+// NOTE: Origin and rotation are not supported, texture is sampled with nearest filtering,
+// source pixels outside texture are transparent (font glyphs padding)
+static void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint)
+{
+    (void)origin;
+    (void)rotation;
+
+    if ((texture.id == 0) || (texture.id > RAYGUI_SOFTWARE_MAX_TEXTURES) || (tint.a == 0)) return;
+    if ((dest.width <= 0) || (dest.height <= 0)) return;
+    if (guiSoftware.textures[texture.id - 1].pixels == NULL) return;
+
+    guiSoftware.lastGradientValid = false;
+
+    GuiSoftwareOp op = { 0 };
+    op.type = GUI_SOFTWARE_OP_TEXTURE;
+    op.posX = (int)floorf(dest.x + 0.5f);
+    op.posY = (int)floorf(dest.y + 0.5f);
+    op.width = (int)floorf(dest.x + dest.width + 0.5f) - op.posX;
+    op.height = (int)floorf(dest.y + dest.height + 0.5f) - op.posY;
+    op.color = tint;
+    op.textureId = texture.id;
+    op.source = source;
+    op.dest = dest;
+
+    if ((op.width > 0) && (op.height > 0)) GuiSoftwareDraw(&op);
+}
+
+//-------------------------------------------------------------------------------
+// Text required functions
+//-------------------------------------------------------------------------------
+// Get default font, generated from embedded glyphs data on first call
+// NOTE: Glyph 95 (codepoint 127) is a solid block, used by raygui as white rectangle for shapes
+static Font GetFontDefault(void)
+{
+    if (guiSoftware.defaultFont.texture.id == 0)
+    {
+        #define RAYGUI_SOFTWARE_FONT_GLYPHS     96
+        #define RAYGUI_SOFTWARE_FONT_CELL_X      8
+        #define RAYGUI_SOFTWARE_FONT_CELL_Y     12
+
+        Image atlas = { 0 };
+        atlas.width = 16*RAYGUI_SOFTWARE_FONT_CELL_X;
+        atlas.height = (RAYGUI_SOFTWARE_FONT_GLYPHS/16)*RAYGUI_SOFTWARE_FONT_CELL_Y;
+        atlas.mipmaps = 1;
+        atlas.format = RAYGUI_SOFTWARE_PIXELFORMAT_GRAY_ALPHA;
+        atlas.data = RAYGUI_CALLOC(atlas.width*atlas.height, 2);
+
+        Font font = { 0 };
+        font.baseSize = 10;
+        font.glyphCount = RAYGUI_SOFTWARE_FONT_GLYPHS;
+        font.recs = (Rectangle *)RAYGUI_CALLOC(font.glyphCount, sizeof(Rectangle));
+        font.glyphs = (GlyphInfo *)RAYGUI_CALLOC(font.glyphCount, sizeof(GlyphInfo));
+
+        unsigned char *pixels = (unsigned char *)atlas.data;
+
+        for (int i = 0; i < font.glyphCount; i++)
+        {
+            int cellX = (i%16)*RAYGUI_SOFTWARE_FONT_CELL_X + 1;
+            int cellY = (i/16)*RAYGUI_SOFTWARE_FONT_CELL_Y + 1;
+
+            // Glyph rectangle is 5x10, glyph pixels start on second row
+            font.recs[i] = RAYGUI_CLITERAL(Rectangle){ (float)cellX, (float)cellY, 5, 10 };
+            font.glyphs[i].value = 32 + i;
+            font.glyphs[i].advanceX = 0;    // Glyph rectangle width is used
+
+            for (int x = 0; x < 5; x++)
+            {
+                for (int y = 0; y < 10; y++)
+                {
+                    bool set = (i == 95) || ((y >= 1) && (y <= 7) && (guiSoftwareFontData[i*5 + x] & (1 << (y - 1))));
+
+                    if (set)
+                    {
+                        int index = ((cellY + y)*atlas.width + cellX + x)*2;
+                        pixels[index] = 255;        // Gray
+                        pixels[index + 1] = 255;    // Alpha
+                    }
+                }
+            }
+        }
+
+        font.texture = LoadTextureFromImage(atlas);
+        RAYGUI_FREE(atlas.data);
+
+        guiSoftware.defaultFont = font;
+    }
+
+    return guiSoftware.defaultFont;
+}
+
+// Load font from file
+// NOTE: Not supported by software backend, default font is returned (same as raylib on failure)
+static Font LoadFontEx(const char *fileName, int fontSize, int *codepoints, int codepointCount)
+{
+    (void)fontSize;
+    (void)codepoints;
+    (void)codepointCount;
+
+    RAYGUI_LOG("WARNING: FONT: [%s] Font loading not supported by software backend, default font used\n", fileName);
+
+    return GetFontDefault();
+}
+
+// Measure text size, font glyphs advances scaled to font size
+static Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing)
+{
+    Vector2 size = { 0 };
+
+    if ((text == NULL) || (font.glyphCount <= 0)) return size;
+
+    float scaleFactor = fontSize/(float)font.baseSize;
+    float lineWidth = 0.0f;
+    int lineGlyphs = 0;
+    int lines = 1;
+
+    for (int i = 0; text[i] != '\0'; )
+    {
+        int codepointSize = 0;
+        int codepoint = GetCodepointNext(text + i, &codepointSize);
+        i += codepointSize;
+
+        if (codepoint == '\n')
+        {
+            lineWidth = 0.0f;
+            lineGlyphs = 0;
+            lines++;
+            continue;
+        }
+
+        int index = GuiSoftwareGetGlyphIndex(font, codepoint);
+        float advance = (font.glyphs[index].advanceX != 0)? (float)font.glyphs[index].advanceX : font.recs[index].width;
+
+        lineWidth += advance*scaleFactor + ((lineGlyphs > 0)? spacing : 0.0f);
+        lineGlyphs++;
+
+        if (lineWidth > size.x) size.x = lineWidth;
+    }
+
+    size.y = fontSize*lines;
+
+    return size;
+}
+
+//-------------------------------------------------------------------------------
+// Textures required functions
+//-------------------------------------------------------------------------------
+// Load texture from image, pixels converted to RGBA8
+// NOTE: Supported formats: GRAYSCALE, GRAY_ALPHA, R8G8B8, R8G8B8A8
+static Texture2D LoadTextureFromImage(Image image)
+{
+    Texture2D texture = { 0 };
+
+    int channels = 0;
+    if (image.format == RAYGUI_SOFTWARE_PIXELFORMAT_GRAYSCALE) channels = 1;
+    else if (image.format == RAYGUI_SOFTWARE_PIXELFORMAT_GRAY_ALPHA) channels = 2;
+    else if (image.format == RAYGUI_SOFTWARE_PIXELFORMAT_R8G8B8) channels = 3;
+    else if (image.format == RAYGUI_SOFTWARE_PIXELFORMAT_R8G8B8A8) channels = 4;
+
+    if ((image.data == NULL) || (channels == 0) || (image.width <= 0) || (image.height <= 0))
+    {
+        RAYGUI_LOG("WARNING: TEXTURE: Image format not supported by software backend\n");
+        return texture;
+    }
+
+    for (int i = 0; i < RAYGUI_SOFTWARE_MAX_TEXTURES; i++)
+    {
+        if (guiSoftware.textures[i].pixels == NULL)
+        {
+            const unsigned char *src = (const unsigned char *)image.data;
+            unsigned char *pixels = (unsigned char *)RAYGUI_MALLOC((size_t)image.width*image.height*4);
+
+            for (int p = 0; p < image.width*image.height; p++, src += channels)
+            {
+                unsigned char *dst = pixels + (size_t)p*4;
+
+                if (channels <= 2) dst[0] = dst[1] = dst[2] = src[0];
+                else { dst[0] = src[0]; dst[1] = src[1]; dst[2] = src[2]; }
+
+                dst[3] = ((channels == 2) || (channels == 4))? src[channels - 1] : 255;
+            }
+
+            guiSoftware.textures[i].pixels = pixels;
+            guiSoftware.textures[i].width = image.width;
+            guiSoftware.textures[i].height = image.height;
+
+            texture.id = (unsigned int)(i + 1);
+            texture.width = image.width;
+            texture.height = image.height;
+            texture.mipmaps = 1;
+            texture.format = RAYGUI_SOFTWARE_PIXELFORMAT_R8G8B8A8;
+
+            return texture;
+        }
+    }
+
+    RAYGUI_LOG("WARNING: TEXTURE: Maximum number of software textures reached (%i)\n", RAYGUI_SOFTWARE_MAX_TEXTURES);
+
+    return texture;
+}
+
+// Unload texture pixels
+static void UnloadTexture(Texture2D texture)
+{
+    if ((texture.id == 0) || (texture.id > RAYGUI_SOFTWARE_MAX_TEXTURES)) return;
+
+    GuiSoftwareFlush();     // Draw calls recorded could use texture
+
+    RAYGUI_FREE(guiSoftware.textures[texture.id - 1].pixels);
+    memset(&guiSoftware.textures[texture.id - 1], 0, sizeof(GuiSoftwareTexture));
+
+    if (texture.id == guiSoftware.defaultFont.texture.id) guiSoftware.defaultFont.texture.id = 0;
+}
+
+// Shapes texture is kept for raygui style sets, shapes are drawn directly by backend
+static void SetShapesTexture(Texture2D tex, Rectangle rec)
+{
+    guiSoftware.shapesTexture = tex;
+    guiSoftware.shapesRec = rec;
+}
+
+static Texture2D GetShapesTexture(void) { return guiSoftware.shapesTexture; }
+static Rectangle GetShapesTextureRectangle(void) { return guiSoftware.shapesRec; }
+
+//-------------------------------------------------------------------------------
+// GuiLoadStyle() required functions
+//-------------------------------------------------------------------------------
+// Load text file data, NULL terminated
+static char *LoadFileText(const char *fileName)
+{
+    char *text = NULL;
+    FILE *file = fopen(fileName, "rb");
+
+    if (file != NULL)
+    {
+        fseek(file, 0, SEEK_END);
+        int size = (int)ftell(file);
+        fseek(file, 0, SEEK_SET);
+
+        if (size >= 0)
+        {
+            text = (char *)RAYGUI_MALLOC(size + 1);
+            size = (int)fread(text, 1, size, file);
+            text[size] = '\0';
+        }
+
+        fclose(file);
+    }
+
+    return text;
+}
+
+static void UnloadFileText(char *text) { RAYGUI_FREE(text); }
+
+// Get directory path for a file path, "." if path has no directory
+static const char *GetDirectoryPath(const char *filePath)
+{
+    static char dirPath[512] = { 0 };
+    memset(dirPath, 0, sizeof(dirPath));
+
+    const char *lastSlash = strrchr(filePath, '/');
+    const char *lastBackslash = strrchr(filePath, '\\');
+    if ((lastBackslash != NULL) && ((lastSlash == NULL) || (lastBackslash > lastSlash))) lastSlash = lastBackslash;
+
+    if (lastSlash == NULL) dirPath[0] = '.';
+    else if (lastSlash == filePath) dirPath[0] = lastSlash[0];     // Root directory
+    else
+    {
+        int length = (int)(lastSlash - filePath);
+        if (length > (int)sizeof(dirPath) - 1) length = (int)sizeof(dirPath) - 1;
+        memcpy(dirPath, filePath, length);
+    }
+
+    return dirPath;
+}
+
+// Load codepoints from UTF-8 text
+static int *LoadCodepoints(const char *text, int *count)
+{
+    int length = (int)strlen(text);
+    int *codepoints = (int *)RAYGUI_CALLOC(length + 1, sizeof(int));
+    int codepointCount = 0;
+
+    for (int i = 0; i < length; )
+    {
+        int codepointSize = 0;
+        codepoints[codepointCount++] = GetCodepointNext(text + i, &codepointSize);
+        i += codepointSize;
+    }
+
+    *count = codepointCount;
+
+    return codepoints;
+}
+
+static void UnloadCodepoints(int *codepoints) { RAYGUI_FREE(codepoints); }
+
+// Decompress data (raw DEFLATE)
+static unsigned char *DecompressData(const unsigned char *compData, int compDataSize, int *dataSize)
+{
+    unsigned char *data = GuiSoftwareInflate(compData, compDataSize, dataSize);
+
+    if (data == NULL) RAYGUI_LOG("WARNING: Data decompression failed\n");
+
+    return data;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Fill framebuffer span with color
+// NOTE: Opaque colors are written, translucent colors are blended
+static void GuiSoftwareFillSpan(unsigned char *dst, int count, Color color)
+{
+    if ((count <= 0) || (color.a == 0)) return;
+
+    if (guiSoftware.fillSpan == NULL) GuiSoftwareLoadKernels();
+
+    if (color.a == 255) guiSoftware.fillSpan(dst, count, color);
+    else guiSoftware.blendSpan(dst, count, color);
+}
+
+// Blend color over framebuffer pixel (alpha blending)
+static void GuiSoftwareBlendPixel(unsigned char *dst, Color color)
+{
+    if (color.a == 255) memcpy(dst, &color, 4);
+    else if (color.a > 0)
+    {
+        unsigned int alpha = color.a;
+        unsigned int inverse = 255 - alpha;
+
+        // Alpha channel: alpha + dst.a*(1 - alpha), weighted as color 255
+        dst[0] = (unsigned char)RAYGUI_SOFTWARE_DIV255(color.r*alpha + dst[0]*inverse);
+        dst[1] = (unsigned char)RAYGUI_SOFTWARE_DIV255(color.g*alpha + dst[1]*inverse);
+        dst[2] = (unsigned char)RAYGUI_SOFTWARE_DIV255(color.b*alpha + dst[2]*inverse);
+        dst[3] = (unsigned char)RAYGUI_SOFTWARE_DIV255(255*alpha + dst[3]*inverse);
+    }
+}
+
+// Fill span with opaque color, scalar kernel
+// NOTE: Colors with equal components are filled with memset(), others by doubling copies
+static void GuiSoftwareFillSpanScalar(unsigned char *dst, int count, Color color)
+{
+    if ((color.r == color.g) && (color.r == color.b) && (color.r == color.a)) memset(dst, color.r, (size_t)count*4);
+    else if (count > 0)
+    {
+        memcpy(dst, &color, 4);
+
+        for (int filled = 1; filled < count; )
+        {
+            int copy = ((count - filled) < filled)? (count - filled) : filled;
+            memcpy(dst + filled*4, dst, copy*4);
+            filled += copy;
+        }
+    }
+}
+
+// Blend span with translucent color, scalar kernel
+static void GuiSoftwareBlendSpanScalar(unsigned char *dst, int count, Color color)
+{
+    for (int i = 0; i < count; i++) GuiSoftwareBlendPixel(dst + i*4, color);
+}
+
+#if defined(RAYGUI_SOFTWARE_SSE2)
+// Fill span with opaque color, SSE2 kernel, 4 pixels per store
+static void GuiSoftwareFillSpanSSE2(unsigned char *dst, int count, Color color)
+{
+    if ((color.r == color.g) && (color.r == color.b) && (color.r == color.a)) { memset(dst, color.r, (size_t)count*4); return; }
+
+    int pattern = 0;
+    memcpy(&pattern, &color, 4);
+    const __m128i pixels = _mm_set1_epi32(pattern);
+
+    int i = 0;
+    for (; (i + 4) <= count; i += 4) _mm_storeu_si128((__m128i *)(dst + i*4), pixels);
+    for (; i < count; i++) memcpy(dst + i*4, &color, 4);
+}
+
+// Blend span with translucent color, SSE2 kernel, 4 pixels per iteration
+// NOTE: Source color is premultiplied once, per pixel: DIV255(source + dst*(255 - alpha)) on 16-bit lanes
+static void GuiSoftwareBlendSpanSSE2(unsigned char *dst, int count, Color color)
+{
+    const short alpha = color.a;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i source = _mm_set_epi16((short)(255*alpha), (short)(color.b*alpha), (short)(color.g*alpha), (short)(color.r*alpha),
+                                         (short)(255*alpha), (short)(color.b*alpha), (short)(color.g*alpha), (short)(color.r*alpha));
+    const __m128i inverse = _mm_set1_epi16((short)(255 - alpha));
+    const __m128i bias = _mm_set1_epi16(128);
+
+    int i = 0;
+    for (; (i + 4) <= count; i += 4)
+    {
+        __m128i pixels = _mm_loadu_si128((const __m128i *)(dst + i*4));
+        __m128i lo = _mm_unpacklo_epi8(pixels, zero);
+        __m128i hi = _mm_unpackhi_epi8(pixels, zero);
+
+        lo = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(lo, inverse), source), bias);
+        hi = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(hi, inverse), source), bias);
+        lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+        hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+
+        _mm_storeu_si128((__m128i *)(dst + i*4), _mm_packus_epi16(lo, hi));
+    }
+
+    if (i < count) GuiSoftwareBlendSpanScalar(dst + i*4, count - i, color);
+}
+#endif
+
+#if defined(RAYGUI_SOFTWARE_AVX2)
+// Fill span with opaque color, AVX2 kernel, 8 pixels per store
+__attribute__((target("avx2")))
+static void GuiSoftwareFillSpanAVX2(unsigned char *dst, int count, Color color)
+{
+    if ((color.r == color.g) && (color.r == color.b) && (color.r == color.a)) { memset(dst, color.r, (size_t)count*4); return; }
+
+    int pattern = 0;
+    memcpy(&pattern, &color, 4);
+    const __m256i pixels = _mm256_set1_epi32(pattern);
+
+    int i = 0;
+    for (; (i + 8) <= count; i += 8) _mm256_storeu_si256((__m256i *)(dst + i*4), pixels);
+    for (; i < count; i++) memcpy(dst + i*4, &color, 4);
+}
+
+// Blend span with translucent color, AVX2 kernel, 8 pixels per iteration
+// NOTE: Same arithmetic as SSE2 kernel, unpack and pack work per 128-bit lane so pixels order is kept
+__attribute__((target("avx2")))
+static void GuiSoftwareBlendSpanAVX2(unsigned char *dst, int count, Color color)
+{
+    const short alpha = color.a;
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i source = _mm256_set_epi16((short)(255*alpha), (short)(color.b*alpha), (short)(color.g*alpha), (short)(color.r*alpha),
+                                            (short)(255*alpha), (short)(color.b*alpha), (short)(color.g*alpha), (short)(color.r*alpha),
+                                            (short)(255*alpha), (short)(color.b*alpha), (short)(color.g*alpha), (short)(color.r*alpha),
+                                            (short)(255*alpha), (short)(color.b*alpha), (short)(color.g*alpha), (short)(color.r*alpha));
+    const __m256i inverse = _mm256_set1_epi16((short)(255 - alpha));
+    const __m256i bias = _mm256_set1_epi16(128);
+
+    int i = 0;
+    for (; (i + 8) <= count; i += 8)
+    {
+        __m256i pixels = _mm256_loadu_si256((const __m256i *)(dst + i*4));
+        __m256i lo = _mm256_unpacklo_epi8(pixels, zero);
+        __m256i hi = _mm256_unpackhi_epi8(pixels, zero);
+
+        lo = _mm256_add_epi16(_mm256_add_epi16(_mm256_mullo_epi16(lo, inverse), source), bias);
+        hi = _mm256_add_epi16(_mm256_add_epi16(_mm256_mullo_epi16(hi, inverse), source), bias);
+        lo = _mm256_srli_epi16(_mm256_add_epi16(lo, _mm256_srli_epi16(lo, 8)), 8);
+        hi = _mm256_srli_epi16(_mm256_add_epi16(hi, _mm256_srli_epi16(hi, 8)), 8);
+
+        _mm256_storeu_si256((__m256i *)(dst + i*4), _mm256_packus_epi16(lo, hi));
+    }
+
+    if (i < count) GuiSoftwareBlendSpanSSE2(dst + i*4, count - i, color);
+}
+#endif
+
+#if defined(RAYGUI_SOFTWARE_NEON)
+// Fill span with opaque color, NEON kernel, 4 pixels per store
+static void GuiSoftwareFillSpanNEON(unsigned char *dst, int count, Color color)
+{
+    if ((color.r == color.g) && (color.r == color.b) && (color.r == color.a)) { memset(dst, color.r, (size_t)count*4); return; }
+
+    unsigned int pattern = 0;
+    memcpy(&pattern, &color, 4);
+    const uint8x16_t pixels = vreinterpretq_u8_u32(vdupq_n_u32(pattern));
+
+    int i = 0;
+    for (; (i + 4) <= count; i += 4) vst1q_u8(dst + i*4, pixels);
+    for (; i < count; i++) memcpy(dst + i*4, &color, 4);
+}
+
+// Blend span with translucent color, NEON kernel, 4 pixels per iteration
+// NOTE: vrsraq/vrshrn rounding matches RAYGUI_SOFTWARE_DIV255()
+static void GuiSoftwareBlendSpanNEON(unsigned char *dst, int count, Color color)
+{
+    const unsigned short alpha = color.a;
+    const unsigned short premultiplied[8] = { (unsigned short)(color.r*alpha), (unsigned short)(color.g*alpha), (unsigned short)(color.b*alpha), (unsigned short)(255*alpha),
+                                              (unsigned short)(color.r*alpha), (unsigned short)(color.g*alpha), (unsigned short)(color.b*alpha), (unsigned short)(255*alpha) };
+    const uint16x8_t source = vld1q_u16(premultiplied);
+    const uint8x8_t inverse = vdup_n_u8((unsigned char)(255 - alpha));
+
+    int i = 0;
+    for (; (i + 4) <= count; i += 4)
+    {
+        uint8x16_t pixels = vld1q_u8(dst + i*4);
+        uint16x8_t lo = vmlal_u8(source, vget_low_u8(pixels), inverse);
+        uint16x8_t hi = vmlal_u8(source, vget_high_u8(pixels), inverse);
+
+        vst1q_u8(dst + i*4, vcombine_u8(vrshrn_n_u16(vrsraq_n_u16(lo, lo, 8), 8), vrshrn_n_u16(vrsraq_n_u16(hi, hi, 8), 8)));
+    }
+
+    if (i < count) GuiSoftwareBlendSpanScalar(dst + i*4, count - i, color);
+}
+#endif
+
+// Blend source pixels row, scalar kernel
+static void GuiSoftwareBlendRowScalar(unsigned char *dst, const unsigned char *src, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        Color color = { src[i*4], src[i*4 + 1], src[i*4 + 2], src[i*4 + 3] };
+        GuiSoftwareBlendPixel(dst + i*4, color);
+    }
+}
+
+// Write gradient span, scalar kernel
+// NOTE: Rounding bias is included in start values, channels are clamped to [0..255]
+static void GuiSoftwareGradientSpanScalar(unsigned char *dst, int count, const int *start, const int *step)
+{
+    int value[4] = { start[0], start[1], start[2], start[3] };
+
+    for (int i = 0; i < count; i++, dst += 4)
+    {
+        for (int c = 0; c < 4; c++)
+        {
+            int channel = value[c] >> 16;
+            dst[c] = (unsigned char)((channel < 0)? 0 : ((channel > 255)? 255 : channel));
+            value[c] += step[c];
+        }
+    }
+}
+
+#if defined(RAYGUI_SOFTWARE_SSE2)
+// Blend source pixels row, SSE2 kernel, 4 pixels per iteration
+// NOTE: Alpha is broadcast per pixel, source alpha channel is weighted as color 255
+static void GuiSoftwareBlendRowSSE2(unsigned char *dst, const unsigned char *src, int count)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i alphaMask = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0);
+    const __m128i full = _mm_set1_epi16(255);
+    const __m128i bias = _mm_set1_epi16(128);
+
+    int i = 0;
+    for (; (i + 4) <= count; i += 4)
+    {
+        __m128i source = _mm_loadu_si128((const __m128i *)(src + i*4));
+        __m128i pixels = _mm_loadu_si128((const __m128i *)(dst + i*4));
+        __m128i result[2] = { 0 };
+
+        for (int k = 0; k < 2; k++)
+        {
+            __m128i s16 = (k == 0)? _mm_unpacklo_epi8(source, zero) : _mm_unpackhi_epi8(source, zero);
+            __m128i d16 = (k == 0)? _mm_unpacklo_epi8(pixels, zero) : _mm_unpackhi_epi8(pixels, zero);
+            __m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s16, 0xff), 0xff);
+
+            s16 = _mm_or_si128(_mm_andnot_si128(alphaMask, s16), _mm_and_si128(alphaMask, full));
+
+            __m128i value = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(s16, alpha), _mm_mullo_epi16(d16, _mm_sub_epi16(full, alpha))), bias);
+            result[k] = _mm_srli_epi16(_mm_add_epi16(value, _mm_srli_epi16(value, 8)), 8);
+        }
+
+        _mm_storeu_si128((__m128i *)(dst + i*4), _mm_packus_epi16(result[0], result[1]));
+    }
+
+    if (i < count) GuiSoftwareBlendRowScalar(dst + i*4, src + i*4, count - i);
+}
+
+// Write gradient span, SSE2 kernel, 4 pixels per iteration
+// NOTE: Saturated packing clamps channels to [0..255], same as scalar kernel
+static void GuiSoftwareGradientSpanSSE2(unsigned char *dst, int count, const int *start, const int *step)
+{
+    const __m128i delta = _mm_loadu_si128((const __m128i *)step);
+    const __m128i delta4 = _mm_slli_epi32(delta, 2);
+    __m128i v0 = _mm_loadu_si128((const __m128i *)start);
+    __m128i v1 = _mm_add_epi32(v0, delta);
+    __m128i v2 = _mm_add_epi32(v1, delta);
+    __m128i v3 = _mm_add_epi32(v2, delta);
+
+    int i = 0;
+    for (; (i + 4) <= count; i += 4)
+    {
+        __m128i p01 = _mm_packs_epi32(_mm_srai_epi32(v0, 16), _mm_srai_epi32(v1, 16));
+        __m128i p23 = _mm_packs_epi32(_mm_srai_epi32(v2, 16), _mm_srai_epi32(v3, 16));
+
+        _mm_storeu_si128((__m128i *)(dst + i*4), _mm_packus_epi16(p01, p23));
+
+        v0 = _mm_add_epi32(v0, delta4);
+        v1 = _mm_add_epi32(v1, delta4);
+        v2 = _mm_add_epi32(v2, delta4);
+        v3 = _mm_add_epi32(v3, delta4);
+    }
+
+    if (i < count)
+    {
+        int value[4] = { 0 };
+        _mm_storeu_si128((__m128i *)value, v0);
+        GuiSoftwareGradientSpanScalar(dst + i*4, count - i, value, step);
+    }
+}
+#endif
+
+#if defined(RAYGUI_SOFTWARE_NEON)
+// Blend source pixels row, NEON kernel, 8 pixels per iteration
+// NOTE: Pixels are deinterleaved by channel, source alpha channel is weighted as color 255
+static void GuiSoftwareBlendRowNEON(unsigned char *dst, const unsigned char *src, int count)
+{
+    const uint8x8_t full = vdup_n_u8(255);
+
+    int i = 0;
+    for (; (i + 8) <= count; i += 8)
+    {
+        uint8x8x4_t source = vld4_u8(src + i*4);
+        uint8x8x4_t pixels = vld4_u8(dst + i*4);
+        uint8x8_t alpha = source.val[3];
+        uint8x8_t inverse = vmvn_u8(alpha);
+
+        source.val[3] = full;
+
+        for (int c = 0; c < 4; c++)
+        {
+            uint16x8_t value = vmlal_u8(vmull_u8(source.val[c], alpha), pixels.val[c], inverse);
+            pixels.val[c] = vrshrn_n_u16(vrsraq_n_u16(value, value, 8), 8);
+        }
+
+        vst4_u8(dst + i*4, pixels);
+    }
+
+    if (i < count) GuiSoftwareBlendRowScalar(dst + i*4, src + i*4, count - i);
+}
+
+// Write gradient span, NEON kernel, 4 pixels per iteration
+// NOTE: Saturated narrowing clamps channels to [0..255], same as scalar kernel
+static void GuiSoftwareGradientSpanNEON(unsigned char *dst, int count, const int *start, const int *step)
+{
+    const int32x4_t delta = vld1q_s32(step);
+    const int32x4_t delta4 = vshlq_n_s32(delta, 2);
+    int32x4_t v0 = vld1q_s32(start);
+    int32x4_t v1 = vaddq_s32(v0, delta);
+    int32x4_t v2 = vaddq_s32(v1, delta);
+    int32x4_t v3 = vaddq_s32(v2, delta);
+
+    int i = 0;
+    for (; (i + 4) <= count; i += 4)
+    {
+        int16x8_t p01 = vcombine_s16(vqmovn_s32(vshrq_n_s32(v0, 16)), vqmovn_s32(vshrq_n_s32(v1, 16)));
+        int16x8_t p23 = vcombine_s16(vqmovn_s32(vshrq_n_s32(v2, 16)), vqmovn_s32(vshrq_n_s32(v3, 16)));
+
+        vst1q_u8(dst + i*4, vcombine_u8(vqmovun_s16(p01), vqmovun_s16(p23)));
+
+        v0 = vaddq_s32(v0, delta4);
+        v1 = vaddq_s32(v1, delta4);
+        v2 = vaddq_s32(v2, delta4);
+        v3 = vaddq_s32(v3, delta4);
+    }
+
+    if (i < count)
+    {
+        int value[4] = { 0 };
+        vst1q_s32(value, v0);
+        GuiSoftwareGradientSpanScalar(dst + i*4, count - i, value, step);
+    }
+}
+#endif
+
+// Select span kernels supported by CPU
+static void GuiSoftwareLoadKernels(void)
+{
+    guiSoftware.fillSpan = GuiSoftwareFillSpanScalar;
+    guiSoftware.blendSpan = GuiSoftwareBlendSpanScalar;
+    guiSoftware.blendRow = GuiSoftwareBlendRowScalar;
+    guiSoftware.gradientSpan = GuiSoftwareGradientSpanScalar;
+    guiSoftware.kernels = "scalar";
+
+#if defined(RAYGUI_SOFTWARE_SSE2)
+    guiSoftware.fillSpan = GuiSoftwareFillSpanSSE2;
+    guiSoftware.blendSpan = GuiSoftwareBlendSpanSSE2;
+    guiSoftware.blendRow = GuiSoftwareBlendRowSSE2;
+    guiSoftware.gradientSpan = GuiSoftwareGradientSpanSSE2;
+    guiSoftware.kernels = "SSE2";
+#endif
+#if defined(RAYGUI_SOFTWARE_AVX2)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+    {
+        guiSoftware.fillSpan = GuiSoftwareFillSpanAVX2;
+        guiSoftware.blendSpan = GuiSoftwareBlendSpanAVX2;
+        guiSoftware.kernels = "AVX2";
+    }
+#endif
+#if defined(RAYGUI_SOFTWARE_NEON)
+    guiSoftware.fillSpan = GuiSoftwareFillSpanNEON;
+    guiSoftware.blendSpan = GuiSoftwareBlendSpanNEON;
+    guiSoftware.blendRow = GuiSoftwareBlendRowNEON;
+    guiSoftware.gradientSpan = GuiSoftwareGradientSpanNEON;
+    guiSoftware.kernels = "NEON";
+#endif
+}
+
+// Render gradient pixels, columns and rows range, corner colors interpolated bilinearly at pixel centers
+// NOTE: Row edges colors are computed per row, pixels are stepped in 16.16 fixed point,
+// pixels values do not depend on range rendered
+static void GuiSoftwareRenderGradient(unsigned char *pixels, const GuiSoftwareGradientKey *key, int columnStart, int columnCount, int rowStart, int rowCount)
+{
+    const unsigned char *col1 = &key->colors[0].r;     // Top-left
+    const unsigned char *col2 = &key->colors[1].r;     // Bottom-left
+    const unsigned char *col3 = &key->colors[2].r;     // Bottom-right
+    const unsigned char *col4 = &key->colors[3].r;     // Top-right
+
+    float firstX = (0.5f - key->offsetX)/key->width;   // First pixel center, normalized
+    float stepX = 1.0f/key->width;
+
+    for (int y = rowStart; y < (rowStart + rowCount); y++)
+    {
+        float ty = ((float)y + 0.5f - key->offsetY)/key->height;
+        int start[4] = { 0 };
+        int step[4] = { 0 };
+
+        for (int c = 0; c < 4; c++)
+        {
+            float left = col1[c] + (col2[c] - col1[c])*ty;
+            float right = col4[c] + (col3[c] - col4[c])*ty;
+
+            start[c] = (int)((left + (right - left)*firstX)*65536.0f) + 32768;     // Rounding bias included
+            step[c] = (int)((right - left)*stepX*65536.0f);
+            start[c] += columnStart*step[c];
+        }
+
+        guiSoftware.gradientSpan(pixels + (size_t)(y - rowStart)*columnCount*4, columnCount, start, step);
+    }
+}
+
+// Get gradient from cache, rendered if required
+// NOTE: Least recently used gradient is replaced when cache is full, NULL if all gradients are in use
+static GuiSoftwareGradient *GuiSoftwareGetGradient(const GuiSoftwareGradientKey *key, int width, int height)
+{
+    GuiSoftwareGradient *gradient = NULL;
+    guiSoftware.gradientCounter++;
+
+    for (int i = 0; i < RAYGUI_SOFTWARE_GRADIENT_CACHE_SIZE; i++)
+    {
+        GuiSoftwareGradient *entry = &guiSoftware.gradients[i];
+
+        if ((entry->pixels != NULL) && (memcmp(&entry->key, key, sizeof(GuiSoftwareGradientKey)) == 0))
+        {
+            entry->lastUsed = guiSoftware.gradientCounter;
+            return entry;
+        }
+
+        // Gradients referenced by draw calls recorded are not replaced
+        bool replaceable = (entry->pixels == NULL) || (entry->lastUsed <= guiSoftware.gradientPinned);
+
+        if (replaceable && ((gradient == NULL) || (entry->pixels == NULL) || ((gradient->pixels != NULL) && (entry->lastUsed < gradient->lastUsed)))) gradient = entry;
+    }
+
+    if (gradient == NULL) return NULL;      // All gradients in use, gradient rendered when rasterized
+
+    if ((gradient->pixels == NULL) || ((gradient->width*gradient->height) != (width*height)))
+    {
+        RAYGUI_FREE(gradient->pixels);
+        gradient->pixels = (unsigned char *)RAYGUI_MALLOC((size_t)width*height*4);
+    }
+
+    gradient->key = *key;
+    gradient->width = width;
+    gradient->height = height;
+    gradient->opaque = (key->colors[0].a == 255) && (key->colors[1].a == 255) && (key->colors[2].a == 255) && (key->colors[3].a == 255);
+    gradient->lastUsed = guiSoftware.gradientCounter;
+
+    GuiSoftwareRenderGradient(gradient->pixels, key, 0, width, 0, height);
+
+    // Overlay gradient blended over gradient pixels, rendered row by row
+    const Color noOverlay[4] = { 0 };
+    if (memcmp(key->overlay, noOverlay, sizeof(noOverlay)) != 0)
+    {
+        GuiSoftwareGradientKey overlay = *key;
+        memcpy(overlay.colors, key->overlay, sizeof(overlay.colors));
+
+        unsigned char *row = GuiSoftwareGetRegionRow(&guiSoftware.regions[0], width);
+
+        for (int y = 0; y < height; y++)
+        {
+            GuiSoftwareRenderGradient(row, &overlay, 0, width, y, 1);
+            guiSoftware.blendRow(gradient->pixels + (size_t)y*width*4, row, width);
+        }
+    }
+
+    return gradient;
+}
+
+// Get region gradient row pixels, grown as required
+static unsigned char *GuiSoftwareGetRegionRow(GuiSoftwareRegion *region, int width)
+{
+    if (region->rowSize < width)
+    {
+        RAYGUI_FREE(region->row);
+        region->row = (unsigned char *)RAYGUI_MALLOC((size_t)width*4);
+        region->rowSize = width;
+    }
+
+    return region->row;
+}
+
+// Draw call, rasterized or recorded (tiled mode)
+// NOTE: Draw call pixels are clipped to framebuffer, draw calls outside framebuffer are discarded
+static void GuiSoftwareDraw(GuiSoftwareOp *op)
+{
+    op->x0 = (op->posX < 0)? 0 : op->posX;
+    op->y0 = (op->posY < 0)? 0 : op->posY;
+    op->x1 = ((op->posX + op->width) > guiSoftware.width)? guiSoftware.width : (op->posX + op->width);
+    op->y1 = ((op->posY + op->height) > guiSoftware.height)? guiSoftware.height : (op->posY + op->height);
+
+    if ((op->x1 <= op->x0) || (op->y1 <= op->y0)) return;
+    if (guiSoftware.fillSpan == NULL) GuiSoftwareLoadKernels();
+
+    int passes = guiSoftware.damageClip? guiSoftware.damageCount : 1;
+
+    if (guiSoftware.threadCount == 0)
+    {
+        for (int i = 0; i < passes; i++)
+        {
+            if (GuiSoftwareSetRegion(&guiSoftware.regions[0], 0, 0, guiSoftware.width, guiSoftware.height, i)) GuiSoftwareRasterOp(&guiSoftware.regions[0], op);
+        }
+
+        guiSoftware.gradientPinned = guiSoftware.gradientCounter;
+    }
+    else
+    {
+        // Draw calls outside damaged rectangles are not recorded
+        GuiSoftwareRegion area = { 0 };
+        bool damaged = false;
+
+        for (int i = 0; (i < passes) && !damaged; i++) damaged = GuiSoftwareSetRegion(&area, op->x0, op->y0, op->x1, op->y1, i);
+
+        if (!damaged) return;
+        if (guiSoftware.opCount == 0) GuiSoftwareResetTiles();
+
+        if (guiSoftware.opCount == guiSoftware.opCapacity)
+        {
+            int capacity = (guiSoftware.opCapacity > 0)? guiSoftware.opCapacity*2 : 1024;
+            GuiSoftwareOp *ops = (GuiSoftwareOp *)RAYGUI_MALLOC(capacity*sizeof(GuiSoftwareOp));
+
+            if (guiSoftware.opCount > 0) memcpy(ops, guiSoftware.ops, guiSoftware.opCount*sizeof(GuiSoftwareOp));
+            RAYGUI_FREE(guiSoftware.ops);
+
+            guiSoftware.ops = ops;
+            guiSoftware.opCapacity = capacity;
+        }
+
+        // Draw call binned into tile rows covered, row tiles are binned when flushed
+        for (int ty = op->y0/RAYGUI_SOFTWARE_TILE_SIZE; ty <= (op->y1 - 1)/RAYGUI_SOFTWARE_TILE_SIZE; ty++)
+        {
+            GuiSoftwareTileRow *row = &guiSoftware.tileRows[ty];
+
+            if (row->opCount == row->opCapacity)
+            {
+                int capacity = (row->opCapacity > 0)? row->opCapacity*2 : 256;
+                int *rowOps = (int *)RAYGUI_MALLOC(capacity*sizeof(int));
+
+                if (row->opCount > 0) memcpy(rowOps, row->ops, row->opCount*sizeof(int));
+                RAYGUI_FREE(row->ops);
+
+                row->ops = rowOps;
+                row->opCapacity = capacity;
+            }
+
+            row->ops[row->opCount++] = guiSoftware.opCount;
+        }
+
+        guiSoftware.ops[guiSoftware.opCount++] = *op;
+    }
+}
+
+// Rasterize draw call clipped to region
+// NOTE: Pixels values only depend on pixel position, not on region, so tiles output matches immediate mode
+static void GuiSoftwareRasterOp(GuiSoftwareRegion *region, const GuiSoftwareOp *op)
+{
+    int x0 = (op->x0 < region->x0)? region->x0 : op->x0;
+    int y0 = (op->y0 < region->y0)? region->y0 : op->y0;
+    int x1 = (op->x1 > region->x1)? region->x1 : op->x1;
+    int y1 = (op->y1 > region->y1)? region->y1 : op->y1;
+
+    if ((x1 <= x0) || (y1 <= y0)) return;
+
+    size_t stride = (size_t)guiSoftware.width*4;
+    unsigned char *row = guiSoftware.pixels + (size_t)y0*stride + (size_t)x0*4;
+    int count = x1 - x0;
+
+    switch (op->type)
+    {
+        case GUI_SOFTWARE_OP_CLEAR:
+        {
+            // Framebuffer rows are packed, full rows cleared as a single span
+            if (count == guiSoftware.width) guiSoftware.fillSpan(row, count*(y1 - y0), op->color);
+            else for (int y = y0; y < y1; y++) guiSoftware.fillSpan(row + (y - y0)*stride, count, op->color);
+        } break;
+        case GUI_SOFTWARE_OP_RECTANGLE:
+        {
+            GuiSoftwareFillSpan(row, count, op->color);
+
+            // Opaque rows are all equal, first row is copied
+            if (op->color.a == 255) for (int y = y0 + 1; y < y1; y++) memcpy(row + (y - y0)*stride, row, (size_t)count*4);
+            else for (int y = y0 + 1; y < y1; y++) GuiSoftwareFillSpan(row + (y - y0)*stride, count, op->color);
+        } break;
+        case GUI_SOFTWARE_OP_GRADIENT:
+        {
+            const GuiSoftwareGradient *gradient = op->gradient;
+
+            for (int y = y0; y < y1; y++)
+            {
+                unsigned char *dst = row + (y - y0)*stride;
+
+                if (gradient != NULL)
+                {
+                    const unsigned char *src = gradient->pixels + ((size_t)(y - op->posY)*op->width + (x0 - op->posX))*4;
+
+                    if (gradient->opaque) memcpy(dst, src, (size_t)count*4);
+                    else guiSoftware.blendRow(dst, src, count);
+                }
+                else
+                {
+                    // Gradient not cached, rendered row by row
+                    unsigned char *src = GuiSoftwareGetRegionRow(region, count);
+
+                    GuiSoftwareRenderGradient(src, &op->key, x0 - op->posX, count, y - op->posY, 1);
+                    guiSoftware.blendRow(dst, src, count);
+                }
+            }
+        } break;
+        case GUI_SOFTWARE_OP_TEXTURE:
+        {
+            const GuiSoftwareTexture *tex = &guiSoftware.textures[op->textureId - 1];
+            Rectangle source = op->source;
+            Rectangle dest = op->dest;
+            Color tint = op->color;
+
+            float scaleX = source.width/dest.width;
+            float scaleY = source.height/dest.height;
+
+            for (int y = y0; y < y1; y++)
+            {
+                int sy = (int)floorf(source.y + ((float)y + 0.5f - dest.y)*scaleY);
+
+                if ((sy < 0) || (sy >= tex->height)) continue;
+
+                const unsigned char *srcRow = tex->pixels + (size_t)sy*tex->width*4;
+                unsigned char *dst = row + (y - y0)*stride;
+
+                for (int x = x0; x < x1; x++, dst += 4)
+                {
+                    int sx = (int)floorf(source.x + ((float)x + 0.5f - dest.x)*scaleX);
+
+                    if ((sx < 0) || (sx >= tex->width)) continue;
+
+                    const unsigned char *texel = srcRow + sx*4;
+
+                    if (texel[3] == 0) continue;
+
+                    Color color = {
+                        (unsigned char)RAYGUI_SOFTWARE_DIV255(texel[0]*tint.r),
+                        (unsigned char)RAYGUI_SOFTWARE_DIV255(texel[1]*tint.g),
+                        (unsigned char)RAYGUI_SOFTWARE_DIV255(texel[2]*tint.b),
+                        (unsigned char)RAYGUI_SOFTWARE_DIV255(texel[3]*tint.a)
+                    };
+
+                    GuiSoftwareBlendPixel(dst, color);
+                }
+            }
+        } break;
+        default: break;
+    }
+}
+
+// Reset tile rows for framebuffer size, draw calls binned are discarded
+// NOTE: Called when first draw call of a flush is recorded, framebuffer size can not change until flushed
+static void GuiSoftwareResetTiles(void)
+{
+    int tilesX = (guiSoftware.width + RAYGUI_SOFTWARE_TILE_SIZE - 1)/RAYGUI_SOFTWARE_TILE_SIZE;
+    int tilesY = (guiSoftware.height + RAYGUI_SOFTWARE_TILE_SIZE - 1)/RAYGUI_SOFTWARE_TILE_SIZE;
+
+    if (guiSoftware.tileRowCapacity < tilesY)
+    {
+        GuiSoftwareTileRow *rows = (GuiSoftwareTileRow *)RAYGUI_CALLOC(tilesY, sizeof(GuiSoftwareTileRow));
+
+        if (guiSoftware.tileRowCapacity > 0) memcpy(rows, guiSoftware.tileRows, guiSoftware.tileRowCapacity*sizeof(GuiSoftwareTileRow));
+        RAYGUI_FREE(guiSoftware.tileRows);
+
+        guiSoftware.tileRows = rows;
+        guiSoftware.tileRowCapacity = tilesY;
+    }
+
+    for (int ty = 0; ty < tilesY; ty++)
+    {
+        GuiSoftwareTileRow *row = &guiSoftware.tileRows[ty];
+
+        row->opCount = 0;
+
+        if (row->tileCapacity < (tilesX + 1))
+        {
+            RAYGUI_FREE(row->tileOffsets);
+            row->tileOffsets = (int *)RAYGUI_MALLOC((tilesX + 1)*sizeof(int));
+            row->tileCapacity = tilesX + 1;
+        }
+    }
+
+    if (guiSoftware.tileCapacity < (tilesX*tilesY))
+    {
+        RAYGUI_FREE(guiSoftware.tiles);
+        guiSoftware.tiles = (int *)RAYGUI_MALLOC(tilesX*tilesY*sizeof(int));
+        guiSoftware.tileCapacity = tilesX*tilesY;
+    }
+
+    guiSoftware.tilesX = tilesX;
+    guiSoftware.tilesY = tilesY;
+}
+
+// Bin draw calls into row tiles until all rows are taken, wait for all rows binned
+// NOTE: Tiles with draw calls and damaged are added to tiles list, empty tiles are not rasterized
+static void GuiSoftwareBinTiles(void)
+{
+    int tileSize = RAYGUI_SOFTWARE_TILE_SIZE;
+    int tilesX = guiSoftware.tilesX;
+    int tilesY = guiSoftware.tilesY;
+
+    for (;;)
+    {
+        int ty = RAYGUI_SOFTWARE_ATOMIC_ADD(&guiSoftware.nextRow, 1);
+
+        if (ty >= tilesY) break;
+
+        GuiSoftwareTileRow *row = &guiSoftware.tileRows[ty];
+
+        if (row->opCount > 0)
+        {
+            // Count draw calls per row tile, offsets are set to tiles ranges ends
+            int *offsets = row->tileOffsets;
+            memset(offsets, 0, (tilesX + 1)*sizeof(int));
+
+            for (int i = 0; i < row->opCount; i++)
+            {
+                const GuiSoftwareOp *op = &guiSoftware.ops[row->ops[i]];
+
+                for (int tx = op->x0/tileSize; tx <= (op->x1 - 1)/tileSize; tx++) offsets[tx]++;
+            }
+
+            for (int tx = 1; tx <= tilesX; tx++) offsets[tx] += offsets[tx - 1];
+
+            if (row->tileOpsCapacity < offsets[tilesX])
+            {
+                RAYGUI_FREE(row->tileOps);
+                row->tileOps = (int *)RAYGUI_MALLOC(offsets[tilesX]*sizeof(int));
+                row->tileOpsCapacity = offsets[tilesX];
+            }
+
+            // Draw calls indices filled backwards, offsets are moved to tiles ranges starts
+            for (int i = row->opCount - 1; i >= 0; i--)
+            {
+                const GuiSoftwareOp *op = &guiSoftware.ops[row->ops[i]];
+
+                for (int tx = op->x0/tileSize; tx <= (op->x1 - 1)/tileSize; tx++) row->tileOps[--offsets[tx]] = row->ops[i];
+            }
+
+            // Tiles with draw calls and damaged are added to tiles list, list order is not relevant
+            int passes = guiSoftware.damageClip? guiSoftware.damageCount : 1;
+            int y0 = ty*tileSize;
+            int y1 = ((y0 + tileSize) > guiSoftware.height)? guiSoftware.height : (y0 + tileSize);
+
+            for (int tx = 0; tx < tilesX; tx++)
+            {
+                if (offsets[tx + 1] == offsets[tx]) continue;
+
+                GuiSoftwareRegion area = { 0 };
+                int x0 = tx*tileSize;
+                int x1 = ((x0 + tileSize) > guiSoftware.width)? guiSoftware.width : (x0 + tileSize);
+                bool damaged = false;
+
+                for (int d = 0; (d < passes) && !damaged; d++) damaged = GuiSoftwareSetRegion(&area, x0, y0, x1, y1, d);
+
+                if (damaged) guiSoftware.tiles[RAYGUI_SOFTWARE_ATOMIC_ADD(&guiSoftware.tileCount, 1)] = ty*tilesX + tx;
+            }
+        }
+
+#if !defined(RAYGUI_SOFTWARE_NO_THREADS)
+        // Last row binned wakes up threads waiting for binning
+        if ((RAYGUI_SOFTWARE_ATOMIC_ADD(&guiSoftware.rowsBinned, 1) == (tilesY - 1)) && (guiSoftware.workerCount > 0))
+        {
+            RAYGUI_SOFTWARE_LOCK(&guiSoftware.workLock);
+            RAYGUI_SOFTWARE_WAKE(&guiSoftware.workBinned);
+            RAYGUI_SOFTWARE_UNLOCK(&guiSoftware.workLock);
+        }
+#endif
+    }
+
+#if !defined(RAYGUI_SOFTWARE_NO_THREADS)
+    // Rows still binned by other threads, tiles can not be rasterized until all rows are binned
+    if ((guiSoftware.workerCount > 0) && (RAYGUI_SOFTWARE_ATOMIC_LOAD(&guiSoftware.rowsBinned) < tilesY))
+    {
+        RAYGUI_SOFTWARE_LOCK(&guiSoftware.workLock);
+        while (RAYGUI_SOFTWARE_ATOMIC_LOAD(&guiSoftware.rowsBinned) < tilesY) RAYGUI_SOFTWARE_WAIT(&guiSoftware.workBinned, &guiSoftware.workLock);
+        RAYGUI_SOFTWARE_UNLOCK(&guiSoftware.workLock);
+    }
+#endif
+}
+
+// Rasterize tiles until all tiles are taken
+static void GuiSoftwareRasterTiles(GuiSoftwareRegion *region)
+{
+    int tileCount = RAYGUI_SOFTWARE_ATOMIC_LOAD(&guiSoftware.tileCount);
+
+    for (;;)
+    {
+        int index = RAYGUI_SOFTWARE_ATOMIC_ADD(&guiSoftware.nextTile, 1);
+
+        if (index >= tileCount) break;
+
+        int tile = guiSoftware.tiles[index];
+        const GuiSoftwareTileRow *row = &guiSoftware.tileRows[tile/guiSoftware.tilesX];
+        int tx = tile%guiSoftware.tilesX;
+
+        int x0 = tx*RAYGUI_SOFTWARE_TILE_SIZE;
+        int y0 = (tile/guiSoftware.tilesX)*RAYGUI_SOFTWARE_TILE_SIZE;
+        int x1 = ((x0 + RAYGUI_SOFTWARE_TILE_SIZE) > guiSoftware.width)? guiSoftware.width : (x0 + RAYGUI_SOFTWARE_TILE_SIZE);
+        int y1 = ((y0 + RAYGUI_SOFTWARE_TILE_SIZE) > guiSoftware.height)? guiSoftware.height : (y0 + RAYGUI_SOFTWARE_TILE_SIZE);
+        int passes = guiSoftware.damageClip? guiSoftware.damageCount : 1;
+
+        for (int d = 0; d < passes; d++)
+        {
+            if (!GuiSoftwareSetRegion(region, x0, y0, x1, y1, d)) continue;
+
+            for (int i = row->tileOffsets[tx]; i < row->tileOffsets[tx + 1]; i++) GuiSoftwareRasterOp(region, &guiSoftware.ops[row->tileOps[i]]);
+        }
+    }
+}
+
+// Set region to area clipped to damaged rectangle, false if region is empty
+// NOTE: Damaged rectangle is ignored if drawing is not clipped to damaged rectangles
+static bool GuiSoftwareSetRegion(GuiSoftwareRegion *region, int x0, int y0, int x1, int y1, int damage)
+{
+    if (guiSoftware.damageClip)
+    {
+        Rectangle rec = guiSoftware.damage[damage];
+        int recX0 = (int)floorf(rec.x);
+        int recY0 = (int)floorf(rec.y);
+        int recX1 = (int)ceilf(rec.x + rec.width);
+        int recY1 = (int)ceilf(rec.y + rec.height);
+
+        if (x0 < recX0) x0 = recX0;
+        if (y0 < recY0) y0 = recY0;
+        if (x1 > recX1) x1 = recX1;
+        if (y1 > recY1) y1 = recY1;
+    }
+
+    region->x0 = x0;
+    region->y0 = y0;
+    region->x1 = x1;
+    region->y1 = y1;
+
+    return (x1 > x0) && (y1 > y0);
+}
+
+// Get font glyph index for codepoint, '?' glyph if not found
+static int GuiSoftwareGetGlyphIndex(Font font, int codepoint)
+{
+    int fallback = 0;
+
+    for (int i = 0; i < font.glyphCount; i++)
+    {
+        if (font.glyphs[i].value == codepoint) return i;
+        if (font.glyphs[i].value == '?') fallback = i;
+    }
+
+    return fallback;
+}
+
+// Inflate stream state, raw DEFLATE data (RFC 1951)
+typedef struct GuiSoftwareInflateState {
+    const unsigned char *input;     // Compressed data
+    int inputSize;                  // Compressed data size
+    int inputPosition;              // Compressed data position
+    unsigned int bitBuffer;         // Bits read not consumed
+    int bitCount;                   // Number of bits in bit buffer
+    unsigned char *output;          // Decompressed data, grows as required
+    int outputSize;                 // Decompressed data size
+    int outputCapacity;             // Decompressed data capacity
+    bool error;                     // Invalid or truncated data
+} GuiSoftwareInflateState;
+
+// Inflate canonical Huffman code, counts per code length and symbols ordered by code
+typedef struct GuiSoftwareHuffman {
+    short counts[16];               // Number of codes of each length
+    short symbols[288];             // Symbols ordered by code
+} GuiSoftwareHuffman;
+
+// Get bits from inflate stream
+static int GuiSoftwareInflateBits(GuiSoftwareInflateState *state, int count)
+{
+    while (state->bitCount < count)
+    {
+        if (state->inputPosition >= state->inputSize)
+        {
+            state->error = true;
+            return 0;
+        }
+
+        state->bitBuffer |= (unsigned int)state->input[state->inputPosition++] << state->bitCount;
+        state->bitCount += 8;
+    }
+
+    int bits = (int)(state->bitBuffer & ((1u << count) - 1));
+    state->bitBuffer >>= count;
+    state->bitCount -= count;
+
+    return bits;
+}
+
+// Put byte in inflate output, output grows as required
+static void GuiSoftwareInflatePut(GuiSoftwareInflateState *state, unsigned char value)
+{
+    if (state->outputSize == state->outputCapacity)
+    {
+        int capacity = (state->outputCapacity > 0)? state->outputCapacity*2 : 4096;
+        unsigned char *output = (unsigned char *)RAYGUI_MALLOC(capacity);
+
+        if (state->outputSize > 0) memcpy(output, state->output, state->outputSize);
+        RAYGUI_FREE(state->output);
+
+        state->output = output;
+        state->outputCapacity = capacity;
+    }
+
+    state->output[state->outputSize++] = value;
+}
+
+// Build canonical Huffman code from code lengths
+static void GuiSoftwareHuffmanBuild(GuiSoftwareHuffman *huffman, const unsigned char *lengths, int count)
+{
+    short offsets[16] = { 0 };
+
+    memset(huffman->counts, 0, sizeof(huffman->counts));
+    for (int i = 0; i < count; i++) huffman->counts[lengths[i]]++;
+    huffman->counts[0] = 0;
+
+    for (int i = 1; i < 15; i++) offsets[i + 1] = offsets[i] + huffman->counts[i];
+    for (int i = 0; i < count; i++) if (lengths[i] != 0) huffman->symbols[offsets[lengths[i]]++] = (short)i;
+}
+
+// Decode one symbol using Huffman code, bit by bit
+static int GuiSoftwareHuffmanDecode(GuiSoftwareInflateState *state, const GuiSoftwareHuffman *huffman)
+{
+    int code = 0;       // Code bits read
+    int first = 0;      // First code of current length
+    int index = 0;      // Symbols index of first code of current length
+
+    for (int length = 1; length < 16; length++)
+    {
+        code |= GuiSoftwareInflateBits(state, 1);
+
+        int count = huffman->counts[length];
+        if ((code - first) < count) return huffman->symbols[index + code - first];
+
+        index += count;
+        first = (first + count) << 1;
+        code <<= 1;
+    }
+
+    state->error = true;    // Code not found, invalid data
+
+    return -1;
+}
+
+// Decompress raw DEFLATE data (RFC 1951)
+// NOTE: Returned data must be freed with RAYGUI_FREE(), NULL on invalid data
+static unsigned char *GuiSoftwareInflate(const unsigned char *data, int dataSize, int *outputSize)
+{
+    static const short lengthBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+    static const short lengthExtra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+    static const short distBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+    static const short distExtra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+    static const unsigned char lengthsOrder[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+    GuiSoftwareInflateState state = { 0 };
+    state.input = data;
+    state.inputSize = dataSize;
+
+    GuiSoftwareHuffman lengthCode = { 0 };
+    GuiSoftwareHuffman distCode = { 0 };
+    bool last = false;
+
+    while (!last && !state.error)
+    {
+        last = (GuiSoftwareInflateBits(&state, 1) == 1);
+        int type = GuiSoftwareInflateBits(&state, 2);
+
+        if (type == 0)
+        {
+            // Stored block, byte aligned
+            state.bitBuffer = 0;
+            state.bitCount = 0;
+
+            if ((state.inputPosition + 4) > state.inputSize) { state.error = true; break; }
+
+            int length = state.input[state.inputPosition] | (state.input[state.inputPosition + 1] << 8);
+            state.inputPosition += 4;
+
+            if ((state.inputPosition + length) > state.inputSize) { state.error = true; break; }
+
+            for (int i = 0; i < length; i++) GuiSoftwareInflatePut(&state, state.input[state.inputPosition++]);
+            continue;
+        }
+        else if (type == 1)
+        {
+            // Fixed Huffman codes
+            unsigned char lengths[288 + 30] = { 0 };
+            for (int i = 0; i < 144; i++) lengths[i] = 8;
+            for (int i = 144; i < 256; i++) lengths[i] = 9;
+            for (int i = 256; i < 280; i++) lengths[i] = 7;
+            for (int i = 280; i < 288; i++) lengths[i] = 8;
+            for (int i = 288; i < 288 + 30; i++) lengths[i] = 5;
+
+            GuiSoftwareHuffmanBuild(&lengthCode, lengths, 288);
+            GuiSoftwareHuffmanBuild(&distCode, lengths + 288, 30);
+        }
+        else if (type == 2)
+        {
+            // Dynamic Huffman codes, code lengths are Huffman coded
+            unsigned char lengths[288 + 30] = { 0 };
+            int lengthCount = GuiSoftwareInflateBits(&state, 5) + 257;
+            int distCount = GuiSoftwareInflateBits(&state, 5) + 1;
+            int codeCount = GuiSoftwareInflateBits(&state, 4) + 4;
+
+            if ((lengthCount > 286) || (distCount > 30)) { state.error = true; break; }
+
+            for (int i = 0; i < codeCount; i++) lengths[lengthsOrder[i]] = (unsigned char)GuiSoftwareInflateBits(&state, 3);
+
+            GuiSoftwareHuffman codeLengthsCode = { 0 };
+            GuiSoftwareHuffmanBuild(&codeLengthsCode, lengths, 19);
+            memset(lengths, 0, 19);
+
+            for (int i = 0; (i < lengthCount + distCount) && !state.error; )
+            {
+                int symbol = GuiSoftwareHuffmanDecode(&state, &codeLengthsCode);
+
+                if (symbol < 16) lengths[i++] = (unsigned char)symbol;
+                else
+                {
+                    int repeat = 0;
+                    unsigned char value = 0;
+
+                    if (symbol == 16)
+                    {
+                        if (i == 0) { state.error = true; break; }
+                        value = lengths[i - 1];
+                        repeat = 3 + GuiSoftwareInflateBits(&state, 2);
+                    }
+                    else if (symbol == 17) repeat = 3 + GuiSoftwareInflateBits(&state, 3);
+                    else repeat = 11 + GuiSoftwareInflateBits(&state, 7);
+
+                    if ((i + repeat) > (lengthCount + distCount)) { state.error = true; break; }
+
+                    while (repeat-- > 0) lengths[i++] = value;
+                }
+            }
+
+            GuiSoftwareHuffmanBuild(&lengthCode, lengths, lengthCount);
+            GuiSoftwareHuffmanBuild(&distCode, lengths + lengthCount, distCount);
+        }
+        else
+        {
+            state.error = true;
+            break;
+        }
+
+        // Decode compressed block, literals and length/distance pairs until end of block
+        while (!state.error)
+        {
+            int symbol = GuiSoftwareHuffmanDecode(&state, &lengthCode);
+
+            if (symbol < 256) GuiSoftwareInflatePut(&state, (unsigned char)symbol);
+            else if (symbol == 256) break;      // End of block
+            else
+            {
+                symbol -= 257;
+                if (symbol >= 29) { state.error = true; break; }
+
+                int length = lengthBase[symbol] + GuiSoftwareInflateBits(&state, lengthExtra[symbol]);
+                int distSymbol = GuiSoftwareHuffmanDecode(&state, &distCode);
+
+                if ((distSymbol < 0) || (distSymbol >= 30)) { state.error = true; break; }
+
+                int distance = distBase[distSymbol] + GuiSoftwareInflateBits(&state, distExtra[distSymbol]);
+
+                if (distance > state.outputSize) { state.error = true; break; }
+
+                for (int i = 0; i < length; i++) GuiSoftwareInflatePut(&state, state.output[state.outputSize - distance]);
+            }
+        }
+    }
+
+    if (state.error)
+    {
+        RAYGUI_FREE(state.output);
+        *outputSize = 0;
+        return NULL;
+    }
+
+    *outputSize = state.outputSize;
+
+    return state.output;
+}
+
+#endif // RAYGUI_SOFTWARE_BACKEND_H
@@ -0,0 +1,184 @@
+/*******************************************************************************************
+*
+*   raygui - Standalone mode software rendering benchmark
+*
+*   Dashboard with many controls rendered on CPU at 4K, immediate mode compared with
+*   tiled mode from 1 to N rasterization threads, tiled output checked to be byte-identical,
+*   throughput scaling reported as frames per second, speedup and efficiency per thread
+*
+*   DEPENDENCIES:
+*       raygui 4.1-dev  - Immediate-mode GUI controls.
+*
+*   USAGE:
+*       raygui_software_benchmark [max_threads] [style.rgs]
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+**********************************************************************************************/
+
+// NOTE: clock_gettime() requires POSIX.1b, not available with strict C99 (-std=c99)
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+    #define _POSIX_C_SOURCE 200112L
+#endif
+
+#define RAYGUI_IMPLEMENTATION
+#define RAYGUI_STANDALONE
+#include "../../src/raygui.h"
+
+#include "raygui_software_backend.h"
+
+#include <stdlib.h>         // Required for: malloc(), free(), atoi()
+
+#if defined(_WIN32)
+    // NOTE: windows.h is not included to avoid conflicts with raylib symbols
+    __declspec(dllimport) int __stdcall QueryPerformanceCounter(long long *count);
+    __declspec(dllimport) int __stdcall QueryPerformanceFrequency(long long *frequency);
+#else
+    #include <time.h>       // Required for: clock_gettime()
+#endif
+
+#define BENCHMARK_FRAMES    60      // Frames rendered per measure
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static float sliderValue = 40.0f;
+static int toggleActive = 1;
+static Color pickerColor = { 200, 40, 120, 255 };
+
+//------------------------------------------------------------------------------------
+// Module Functions Declaration
+//------------------------------------------------------------------------------------
+static void DrawDashboard(int width, int height);   // Draw dashboard controls filling framebuffer
+static double GetTimeSeconds(void);                 // Get monotonic time in seconds
+static double MeasureFrames(unsigned char *pixels, int width, int height, Color background);    // Measure frame time in milliseconds
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //---------------------------------------------------------------------------------------
+    const int screenWidth = 3840;
+    const int screenHeight = 2160;
+
+    int maxThreads = (argc > 1)? atoi(argv[1]) : 8;
+    if (maxThreads < 1) maxThreads = 1;
+    if (maxThreads > RAYGUI_SOFTWARE_MAX_THREADS) maxThreads = RAYGUI_SOFTWARE_MAX_THREADS;
+
+    if (argc > 2) GuiLoadStyle(argv[2]);
+
+    Color background = GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR));
+
+    unsigned char *reference = (unsigned char *)malloc((size_t)screenWidth*screenHeight*4);
+    unsigned char *pixels = (unsigned char *)malloc((size_t)screenWidth*screenHeight*4);
+    //---------------------------------------------------------------------------------------
+
+    printf("Framebuffer: %ix%i, span kernels: %s\n", screenWidth, screenHeight, GuiSoftwareGetKernels());
+
+    // Immediate mode, reference output
+    GuiSoftwareSetThreads(0);
+    double immediate = MeasureFrames(reference, screenWidth, screenHeight, background);
+    printf("Immediate mode: %8.2f ms/frame, %7.2f frames/s\n", immediate, 1000.0/immediate);
+
+    // Tiled mode, 1 to N threads
+    double single = 0.0;
+    bool identical = true;
+
+    for (int threads = 1; threads <= maxThreads; threads++)
+    {
+        GuiSoftwareSetThreads(threads);
+        memset(pixels, 0, (size_t)screenWidth*screenHeight*4);
+
+        double time = MeasureFrames(pixels, screenWidth, screenHeight, background);
+        bool equal = (memcmp(pixels, reference, (size_t)screenWidth*screenHeight*4) == 0);
+
+        if (threads == 1) single = time;
+        if (!equal) identical = false;
+
+        // Throughput scaling compared with single thread, efficiency is speedup per thread
+        printf("Tiled mode, %2i thread(s): %8.2f ms/frame, %7.2f frames/s, speedup %5.2fx, efficiency %5.1f%%, output %s\n",
+            threads, time, 1000.0/time, single/time, 100.0*single/(time*threads), equal? "identical" : "DIFFERENT");
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    GuiUnloadStyle();
+    GuiSoftwareClose();
+    free(reference);
+    free(pixels);
+    //--------------------------------------------------------------------------------------
+
+    return identical? 0 : 1;
+}
+
+//------------------------------------------------------------------------------------
+// Module Functions Definition
+//------------------------------------------------------------------------------------
+// Draw dashboard controls filling framebuffer
+static void DrawDashboard(int width, int height)
+{
+    const int panelWidth = 300;
+    const int panelHeight = 340;
+    int panel = 0;
+
+    for (int y = 10; (y + panelHeight) <= height; y += panelHeight + 10)
+    {
+        for (int x = 10; (x + panelWidth) <= width; x += panelWidth + 10, panel++)
+        {
+            float px = (float)x;
+            float py = (float)y;
+
+            GuiPanel(RAYGUI_CLITERAL(Rectangle){ px, py, (float)panelWidth, (float)panelHeight }, TextFormat("#%i# Panel %i", panel%200, panel));
+            GuiLabel(RAYGUI_CLITERAL(Rectangle){ px + 10, py + 35, 280, 20 }, "Rendered on CPU, tiled rasterization");
+            GuiButton(RAYGUI_CLITERAL(Rectangle){ px + 10, py + 60, 135, 30 }, "#2# Button");
+            GuiButton(RAYGUI_CLITERAL(Rectangle){ px + 155, py + 60, 135, 30 }, "#3# Button");
+            GuiSlider(RAYGUI_CLITERAL(Rectangle){ px + 50, py + 100, 190, 16 }, "Slider", NULL, &sliderValue, 0, 100);
+            GuiProgressBar(RAYGUI_CLITERAL(Rectangle){ px + 50, py + 125, 190, 16 }, "Load", NULL, &sliderValue, 0, 100);
+            GuiToggleGroup(RAYGUI_CLITERAL(Rectangle){ px + 10, py + 150, 90, 24 }, "ONE;TWO;THREE", &toggleActive);
+
+            // Color pickers hue changes per panel, gradients cache is shared between panels with same color
+            Color color = pickerColor;
+            color.g = (unsigned char)((panel%8)*32);
+            GuiColorPicker(RAYGUI_CLITERAL(Rectangle){ px + 10, py + 185, 250, 145 }, NULL, &color);
+        }
+    }
+}
+
+// Get monotonic time in seconds
+static double GetTimeSeconds(void)
+{
+#if defined(_WIN32)
+    long long count = 0;
+    long long frequency = 1;
+    QueryPerformanceCounter(&count);
+    QueryPerformanceFrequency(&frequency);
+
+    return (double)count/(double)frequency;
+#else
+    struct timespec time = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return (double)time.tv_sec + (double)time.tv_nsec*1e-9;
+#endif
+}
+
+// Measure frame time in milliseconds
+static double MeasureFrames(unsigned char *pixels, int width, int height, Color background)
+{
+    GuiSoftwareSetFramebuffer(pixels, width, height);
+
+    double start = GetTimeSeconds();
+
+    for (int frame = 0; frame < BENCHMARK_FRAMES; frame++)
+    {
+        GuiSoftwareClear(background);
+        DrawDashboard(width, height);
+        GuiSoftwareFlush();
+    }
+
+    return (GetTimeSeconds() - start)*1000.0/BENCHMARK_FRAMES;
+}
@@ -0,0 +1,101 @@
+/*******************************************************************************************
+*
+*   raygui - Standalone mode software rendering
+*
+*   Gui rendered on CPU into an image, no window or GPU required, result exported as .ppm
+*
+*   DEPENDENCIES:
+*       raygui 4.1-dev  - Immediate-mode GUI controls.
+*
+*   USAGE:
+*       raygui_software_render [style.rgs]
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+**********************************************************************************************/
+
+#define RAYGUI_IMPLEMENTATION
+#define RAYGUI_STANDALONE
+#include "../../src/raygui.h"
+
+#include "raygui_software_backend.h"
+
+#include <stdlib.h>         // Required for: malloc(), free()
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static bool checked = true;
+static float sliderValue = 40.0f;
+static int toggleActive = 1;
+static char textBuffer[64] = "Software rendered";
+
+//------------------------------------------------------------------------------------
+// Module Functions Declaration
+//------------------------------------------------------------------------------------
+static void DrawGui(void);      // Draw gui controls
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //---------------------------------------------------------------------------------------
+    const int screenWidth = 320;
+    const int screenHeight = 240;
+
+    Image image = { 0 };
+    image.width = screenWidth;
+    image.height = screenHeight;
+    image.mipmaps = 1;
+    image.format = RAYGUI_SOFTWARE_PIXELFORMAT_R8G8B8A8;
+    image.data = malloc(screenWidth*screenHeight*4);
+
+    GuiSoftwareSetFramebuffer((unsigned char *)image.data, screenWidth, screenHeight);
+
+    if (argc > 1) GuiLoadStyle(argv[1]);
+    //---------------------------------------------------------------------------------------
+
+    // Simulate a mouse click over the checkbox: press on first frame, release on second frame
+    GuiSoftwareSetMousePosition(RAYGUI_CLITERAL(Vector2){ 26, 96 });
+    for (int frame = 0; frame < 2; frame++)
+    {
+        GuiSoftwareSetMouseButton(MOUSE_LEFT_BUTTON, (frame == 0));
+        GuiRenderToImage(&image, GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)), DrawGui);
+        GuiSoftwareUpdateInput();
+    }
+
+    // Final frame, mouse away from controls
+    GuiSoftwareSetMousePosition(RAYGUI_CLITERAL(Vector2){ -1, -1 });
+    GuiRenderToImage(&image, GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)), DrawGui);
+
+    if (GuiSoftwareExportImage(image, "raygui_software_render.ppm")) printf("Gui rendered: raygui_software_render.ppm\n");
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    GuiUnloadStyle();
+    GuiSoftwareClose();
+    free(image.data);
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module Functions Definition
+//------------------------------------------------------------------------------------
+// Draw gui controls
+static void DrawGui(void)
+{
+    GuiPanel(RAYGUI_CLITERAL(Rectangle){ 10, 10, 300, 220 }, "#198# Software rendering");
+    GuiLabel(RAYGUI_CLITERAL(Rectangle){ 20, 45, 280, 20 }, "Rendered on CPU, no GPU required");
+    GuiTextBox(RAYGUI_CLITERAL(Rectangle){ 20, 65, 280, 24 }, textBuffer, 64, false);
+    GuiCheckBox(RAYGUI_CLITERAL(Rectangle){ 20, 90, 14, 14 }, "Checkbox", &checked);
+    GuiSlider(RAYGUI_CLITERAL(Rectangle){ 60, 115, 200, 16 }, "Slider", NULL, &sliderValue, 0, 100);
+    GuiToggleGroup(RAYGUI_CLITERAL(Rectangle){ 20, 140, 90, 24 }, "ONE;TWO;THREE", &toggleActive);
+    GuiButton(RAYGUI_CLITERAL(Rectangle){ 20, 175, 130, 30 }, "#2# Button");
+    GuiProgressBar(RAYGUI_CLITERAL(Rectangle){ 160, 182, 140, 16 }, NULL, NULL, &sliderValue, 0, 100);
+}
@@ -64,10 +64,35 @@ int main()
 
     char textInputFileName[256] = { 0 };
 
-    // Load default style
-    GuiLoadStyleBluish();
-    int visualStyleActive = 4;
-    int prevVisualStyleActive = 4;
+    // Load all styles as resident style sets
+    // NOTE: Switching between style sets does not require reloading style properties and font
+    GuiStyleSet *styleSets[12] = { 0 };
+
+    for (int i = 0; i < 12; i++)
+    {
+        styleSets[i] = GuiLoadStyleSet(NULL);   // Style set initialized with default style
+        GuiSetStyleSet(styleSets[i]);
+
+        switch (i)
+        {
+            case 1: GuiLoadStyleJungle(); break;
+            case 2: GuiLoadStyleCandy(); break;
+            case 3: GuiLoadStyleLavanda(); break;
+            case 4: GuiLoadStyleCyber(); break;
+            case 5: GuiLoadStyleTerminal(); break;
+            case 6: GuiLoadStyleAshes(); break;
+            case 7: GuiLoadStyleBluish(); break;
+            case 8: GuiLoadStyleDark(); break;
+            case 9: GuiLoadStyleCherry(); break;
+            case 10: GuiLoadStyleSunny(); break;
+            case 11: GuiLoadStyleEnefete(); break;
+            default: break;
+        }
+    }
+
+    int visualStyleActive = 7;
+    int prevVisualStyleActive = 7;
+    GuiSetStyleSet(styleSets[visualStyleActive]);
 
     SetTargetFPS(60);
     //--------------------------------------------------------------------------------------
@@ -94,25 +119,8 @@ int main()
 
         if (visualStyleActive != prevVisualStyleActive)
         {
-            // Reset to default internal style
-            // NOTE: Required to unload any previously loaded font texture
-            GuiLoadStyleDefault();
-
-            switch (visualStyleActive)
-            {
-                case 1: GuiLoadStyleJungle(); break;
-                case 2: GuiLoadStyleCandy(); break;
-                case 3: GuiLoadStyleLavanda(); break;
-                case 4: GuiLoadStyleCyber(); break;
-                case 5: GuiLoadStyleTerminal(); break;
-                case 6: GuiLoadStyleAshes(); break;
-                case 7: GuiLoadStyleBluish(); break;
-                case 8: GuiLoadStyleDark(); break;
-                case 9: GuiLoadStyleCherry(); break;
-                case 10: GuiLoadStyleSunny(); break;
-                case 11: GuiLoadStyleEnefete(); break;
-                default: break;
-            }
+            // Activate selected style set, no style reloading required
+            GuiSetStyleSet(styleSets[visualStyleActive]);
 
             prevVisualStyleActive = visualStyleActive;
         }
@@ -145,6 +153,8 @@ int main()
 
     // De-Initialization
     //--------------------------------------------------------------------------------------
+    for (int i = 0; i < 12; i++) GuiUnloadStyleSet(styleSets[i]);   // Unload style sets (and fonts)
+
     CloseWindow();        // Close window and OpenGL context
     //--------------------------------------------------------------------------------------
 
@@ -28,7 +28,7 @@
 *         font atlas recs and glyphs, freeing that memory is (usually) up to the user,
 *         no unload function is explicitly provided... but note that GuiLoadStyleDefaulf() unloads
 *         by default any previously loaded font (texture, recs, glyphs).
-*       - Global UI alpha (guiAlpha) is applied inside GuiDrawRectangle() and GuiDrawText() functions
+*       - Global UI alpha (guiAlpha) is applied to controls resolved style colors, see GuiGetStyleColor()
 *
 *   CONTROLS PROVIDED:
 *     # Container/separators Controls
@@ -89,6 +89,10 @@
 *
 *       Custom control properties can be defined using the EXTENDED properties for each independent control.
 *
+*       Several styles can be kept resident as style sets (properties array, font and shapes rectangle),
+*       loaded once with GuiLoadStyleSet() and activated with GuiSetStyleSet(), switching between them
+*       is immediate, so different panels could be drawn with different styles on the same frame
+*
 *       TOOL: rGuiStyler is a visual tool to customize raygui style: github.com/raysan5/rguistyler
 *
 *
@@ -140,8 +144,53 @@
 *       #define RAYGUI_DEBUG_TEXT_BOUNDS
 *           Draw text bounds rectangles for debug
 *
+*       #define RAYGUI_ICON_ATLAS
+*           Draw icons as textured quads from an icons atlas texture instead of one rectangle per icon pixel,
+*           atlas is generated from current icons data on first icon drawing and regenerated when icons
+*           data changes (GuiLoadIcons(), GuiGetIcons()), requires DrawTexturePro() in standalone mode
+*
+*       #define RAYGUI_STYLE_NO_MMAP
+*           Binary style files (.rgs) are read into memory instead of being memory mapped,
+*           memory mapping is only available on POSIX systems (mmap())
+*
+*       #define RAYGUI_STYLE_ASYNC_NO_THREADS
+*           GuiLoadStyleAsync() loads style data on the calling thread instead of a worker thread,
+*           font texture upload and style activation are still deferred to GuiUpdateStyleAsync()
+*
+*       #define RAYGUI_COMMAND_LIST
+*           Record gui drawing (rectangles, gradients, text codepoints and icons) into a per-frame draw
+*           commands list instead of calling backend drawing functions directly, recorded commands are
+*           submitted to the backend with GuiFlush(), a custom callback can be set to process them,
+*           regions changed since previous frame are reported by GuiEndFrame() (damaged rectangles)
+*
+*       #define RAYGUI_DAMAGE_TRACKING
+*           Track damaged regions from first frame (RAYGUI_COMMAND_LIST), by default draw commands are only
+*           tracked after first GuiEndFrame() call, so draw commands list users not calling it do not pay for it
+*
 *   VERSIONS HISTORY:
 *       4.1-dev (2024)    Current dev version...
+*                         ADDED: GuiEndFrame(), damaged regions tracking for partial redraw (RAYGUI_COMMAND_LIST)
+*                         ADDED: GuiFlush(), draw commands list support (RAYGUI_COMMAND_LIST)
+*                         ADDED: Icons atlas drawing support (RAYGUI_ICON_ATLAS)
+*                         ADDED: Gui font glyphs lookup table, avoid linear glyph search on text measuring/drawing
+*                         REVIEWED: GuiDrawText(), word-wrap line breaks computed in linear time and cached
+*                         ADDED: GuiGetTextCacheStats(), text width measures cached by content, font and size
+*                         REVIEWED: GuiTextBox(), text prefix widths index for scrolling and mouse cursor positioning
+*                         ADDED: GuiTextBoxEx(), multiline text box editing a gap buffer (GuiTextBuffer)
+*                         ADDED: GuiLoadTextBuffer(), GuiUnloadTextBuffer(), GuiGetTextBufferView(), GuiGetTextBufferLine()
+*                         REVIEWED: GuiTextBox(), GuiValueBox(), process all characters pressed per frame
+*                         REVIEWED: GuiTextBox(), key repeat timing based on frame time, RAYGUI_TEXTBOX_AUTO_CURSOR_*_SECONDS
+*                         ADDED: Controls resolved styles, all properties resolved, colors converted and faded only when style or alpha changes
+*                         ADDED: GuiPushStyle()/GuiPopStyle(), temporary style overrides without modifying global style
+*                         ADDED: GuiLoadStyleSet(), GuiUnloadStyleSet(), GuiSetStyleSet(), GuiGetStyleSet(), resident style sets
+*                         ADDED: GuiLoadStyleAsync(), GuiUpdateStyleAsync(), style data loaded on a worker thread
+*                         ADDED: GuiExportStyle(), aligned binary style (version 500), loaded in place from memory mapped file
+*                         REVIEWED: GuiLoadStyle(), text styles parsed in a single pass, malformed entries reported
+*                         ADDED: GuiExportStyleAsCode(), GuiLoadStyleImage(), resolved style images, default style as static table
+*                         REVIEWED: GuiSetStyle(), DEFAULT properties inherited on read by controls not overriding them
+*                         ADDED: GuiStyleLerp(), style sets interpolation
+*                         ADDED: GuiUnloadStyle(), fonts loaded by styles cached and reference counted
+*                         ADDED: GuiLoadStyleBundle(), GuiLoadStyleFromBundle(), style bundles (.rgsb) loaded on request
 *
 *       4.0 (12-Sep-2023) ADDED: GuiToggleSlider()
 *                         ADDED: GuiColorPickerHSV() and GuiColorPanelHSV()
@@ -253,6 +302,7 @@
 *   STANDALONE MODE:
 *       By default raygui depends on raylib mostly for the inputs and the drawing functionality but that dependency can be disabled
 *       with the config flag RAYGUI_STANDALONE. In that case is up to the user to provide another backend to cover library needs.
+*       A CPU software rasterizer backend is provided as reference: examples/standalone/raygui_software_backend.h
 *
 *       The following functions should be redefined for a custom backend:
 *
@@ -264,20 +314,27 @@
 *           - bool IsKeyDown(int key);
 *           - bool IsKeyPressed(int key);
 *           - int GetCharPressed(void);         // -- GuiTextBox(), GuiValueBox()
+*           - float GetFrameTime(void);         // -- GuiTextBox(), key repeat timing
+*           - int GetScreenWidth(void);         // -- GuiTabBar(), GuiTooltip()
 *
 *           - void DrawRectangle(int x, int y, int width, int height, Color color); // -- GuiDrawRectangle()
 *           - void DrawRectangleGradientEx(Rectangle rec, Color col1, Color col2, Color col3, Color col4); // -- GuiColorPicker()
+*           - void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint); // -- GuiDrawText()
 *
 *           - Font GetFontDefault(void);                            // -- GuiLoadStyleDefault()
+*           - Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing);   // -- GuiTooltip()
 *           - Font LoadFontEx(const char *fileName, int fontSize, int *codepoints, int codepointCount); // -- GuiLoadStyle()
 *           - Texture2D LoadTextureFromImage(Image image);          // -- GuiLoadStyle(), required to load texture from embedded font atlas image
+*           - void UnloadTexture(Texture2D texture);                // -- GuiUnloadStyle(), required to unload style fonts
 *           - void SetShapesTexture(Texture2D tex, Rectangle rec);  // -- GuiLoadStyle(), required to set shapes rec to font white rec (optimization)
+*           - Texture2D GetShapesTexture(void);                     // -- GuiSetStyleSet(), required to keep style set shapes texture
+*           - Rectangle GetShapesTextureRectangle(void);            // -- GuiSetStyleSet(), required to keep style set shapes rec
 *           - char *LoadFileText(const char *fileName);             // -- GuiLoadStyle(), required to load charset data
 *           - void UnloadFileText(char *text);                      // -- GuiLoadStyle(), required to unload charset data
 *           - const char *GetDirectoryPath(const char *filePath);   // -- GuiLoadStyle(), required to find charset/font file from text .rgs
 *           - int *LoadCodepoints(const char *text, int *count);    // -- GuiLoadStyle(), required to load required font codepoints list
 *           - void UnloadCodepoints(int *codepoints);               // -- GuiLoadStyle(), required to unload codepoints list
-*           - unsigned char *DecompressData(const unsigned char *compData, int compDataSize, int *dataSize); // -- GuiLoadStyle()
+*           - unsigned char *DecompressData(const unsigned char *compData, int compDataSize, int *dataSize); // -- GuiLoadStyle(), GuiLoadStyleFromBundle()
 *
 *   CONTRIBUTORS:
 *       Ramon Santamaria:   Supervision, review, redesign, update and maintenance
@@ -362,6 +419,12 @@
   #define RAYGUI_LOG(...)
 #endif
 
+// WARNING: Those values define the total size of the style data array,
+// if changed, previous saved styles could become incompatible
+#define RAYGUI_MAX_CONTROLS             16      // Maximum number of controls
+#define RAYGUI_MAX_PROPS_BASE           16      // Maximum number of base properties
+#define RAYGUI_MAX_PROPS_EXTENDED        8      // Maximum number of extended properties
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 // NOTE: Some types are required for RAYGUI_STANDALONE usage
@@ -452,6 +515,81 @@ typedef struct GuiStyleProp {
     int propertyValue;          // Property value
 } GuiStyleProp;
 
+// Style set, style properties and font kept resident
+// NOTE: Style sets are loaded with GuiLoadStyleSet() and activated with GuiSetStyleSet(),
+// switching style sets does not require reloading style properties or font
+typedef struct GuiStyleSet {
+    unsigned int props[RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)];  // Style properties
+    unsigned int overrides[RAYGUI_MAX_PROPS_BASE];  // Controls overriding DEFAULT base properties, one bit per control (inherited otherwise)
+    Font font;                  // Style font
+    Texture2D shapesTexture;    // Shapes drawing texture (usually font texture)
+    Rectangle shapesRec;        // Shapes drawing texture source rectangle (white pixels)
+    bool loaded;                // Style properties loaded flag (lazy initialization)
+} GuiStyleSet;
+
+// Style image, fully resolved style properties values and optional font (uncompressed atlas)
+// NOTE: Style images are exported as code with GuiExportStyleAsCode(), loading a style image
+// only requires copying properties values and uploading font atlas texture
+typedef struct GuiStyleImage {
+    const unsigned int *props;  // Style properties values: RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)
+    const unsigned char *fontAtlas; // Font atlas image data, uncompressed (NULL if no custom font)
+    int fontAtlasWidth;         // Font atlas image width
+    int fontAtlasHeight;        // Font atlas image height
+    int fontAtlasFormat;        // Font atlas image format (PixelFormat type)
+    int fontBaseSize;           // Font base size
+    int fontGlyphCount;         // Font glyphs count
+    const Rectangle *fontRecs;  // Font glyphs rectangles in atlas
+    const GlyphInfo *fontGlyphs;    // Font glyphs info
+    Rectangle fontWhiteRec;     // Font white rectangle, used for shapes drawing
+} GuiStyleImage;
+
+// Gui draw command type
+// NOTE: Used by draw commands list (RAYGUI_COMMAND_LIST)
+typedef enum {
+    GUI_COMMAND_RECTANGLE = 0,      // Filled rectangle: rec, colors[0]
+    GUI_COMMAND_RECTANGLE_GRADIENT, // Gradient rectangle: rec, colors[0..3] (top-left, bottom-left, bottom-right, top-right)
+    GUI_COMMAND_GLYPH,              // Text glyph: rec position and advance, value (gui font glyph index), size (font size), colors[0]
+    GUI_COMMAND_ICON                // Icon: rec position and size, value (icon id), size (pixel size), colors[0]
+} GuiDrawCommandType;
+
+// Gui draw command
+// NOTE: Command colors already include global alpha (guiAlpha)
+typedef struct GuiDrawCommand {
+    int type;                   // Command type (GuiDrawCommandType)
+    int value;                  // Command value: glyph index or icon id
+    float size;                 // Command size: font size or icon pixel size
+    Rectangle rec;              // Command rectangle
+    Color colors[4];            // Command colors, only first one used except for gradients
+} GuiDrawCommand;
+
+// Gui draw commands callback, called by GuiFlush() to process recorded commands
+typedef void (*GuiDrawCommandsCallback)(const GuiDrawCommand *commands, int count);
+
+// Gui text buffer, gap buffer for text editing with GuiTextBoxEx()
+// NOTE: Text data keeps a gap at cursor position, so inserting/deleting text at cursor
+// does not require moving the rest of the text, use GuiGetTextBufferView() to access text
+typedef struct GuiTextBuffer {
+    char *data;                 // Text data, including gap (not NULL terminated)
+    int capacity;               // Text data allocated size
+    int length;                 // Text length in bytes (not including gap)
+    int gapStart;               // Gap start position, also used as cursor position
+    int gapEnd;                 // Gap end position
+    int *lineStarts;            // Lines start positions (text positions, not including gap)
+    int lineCount;              // Lines count
+    int lineCapacity;           // Lines start positions allocated capacity
+    int firstLine;              // Text box first visible line
+    float offsetX;              // Text box horizontal scroll offset
+} GuiTextBuffer;
+
+// Gui text view, text range split in two segments (before and after text buffer gap)
+// NOTE: Text segments point to text buffer data, they are not NULL terminated
+typedef struct GuiTextView {
+    const char *first;          // First text segment
+    int firstSize;              // First text segment size in bytes
+    const char *second;         // Second text segment
+    int secondSize;             // Second text segment size in bytes
+} GuiTextView;
+
 /*
 // Controls text style -NOT USED-
 // NOTE: Text style is defined by control
@@ -677,20 +815,52 @@ RAYGUIAPI int GuiGetState(void);                                // Get gui state
 // Font set/get functions
 RAYGUIAPI void GuiSetFont(Font font);                           // Set gui custom font (global state)
 RAYGUIAPI Font GuiGetFont(void);                                // Get gui custom font (global state)
+RAYGUIAPI void GuiGetTextCacheStats(unsigned int *hits, unsigned int *misses); // Get gui text measure cache hits/misses counters
 
 // Style set/get functions
 RAYGUIAPI void GuiSetStyle(int control, int property, int value); // Set one style property
 RAYGUIAPI int GuiGetStyle(int control, int property);           // Get one style property
+RAYGUIAPI void GuiPushStyle(int control, int property, int value); // Push temporary style property value, restored with GuiPopStyle()
+RAYGUIAPI void GuiPopStyle(void);                               // Pop last style property value pushed
 
 // Styles loading functions
 RAYGUIAPI void GuiLoadStyle(const char *fileName);              // Load style file over global style variable (.rgs)
+RAYGUIAPI bool GuiExportStyle(const char *fileName);            // Export current style to binary file (.rgs), aligned for in place loading
+RAYGUIAPI bool GuiExportStyleAsCode(const char *fileName, const char *styleName);  // Export current style as code (.h), resolved style image
+RAYGUIAPI bool GuiLoadStyleBundle(const char *fileName);        // Load style bundle file (.rgsb), only bundle index is read
+RAYGUIAPI void GuiUnloadStyleBundle(void);                      // Unload style bundle
+RAYGUIAPI bool GuiLoadStyleFromBundle(const char *styleName);   // Load style from style bundle over global style, only requested style is read
+RAYGUIAPI bool GuiExportStyleBundle(const char *fileName, const char **styleFileNames, const char **styleNames, int count, bool compress); // Export styles to style bundle file (.rgsb)
+RAYGUIAPI void GuiLoadStyleImage(const GuiStyleImage *image);   // Load style image over global style (resolved properties and font)
 RAYGUIAPI void GuiLoadStyleDefault(void);                       // Load style default over global style
+RAYGUIAPI void GuiUnloadStyle(void);                            // Unload style, default style loaded and fonts not used anymore unloaded
+
+// Style sets functions
+RAYGUIAPI GuiStyleSet *GuiLoadStyleSet(const char *fileName);   // Load style set from file (.rgs), default style if fileName is NULL
+RAYGUIAPI void GuiUnloadStyleSet(GuiStyleSet *set);             // Unload style set (including its custom font)
+RAYGUIAPI void GuiSetStyleSet(GuiStyleSet *set);                // Set active style set, default style set if NULL
+RAYGUIAPI GuiStyleSet *GuiGetStyleSet(void);                    // Get active style set
+RAYGUIAPI void GuiStyleLerp(const GuiStyleSet *from, const GuiStyleSet *to, float t);   // Interpolate style sets into active style set (colors blended)
+RAYGUIAPI bool GuiLoadStyleAsync(const char *fileName, void (*callback)(GuiStyleSet *set)); // Load style set in background (.rgs), activated by GuiUpdateStyleAsync()
+RAYGUIAPI GuiStyleSet *GuiUpdateStyleAsync(void);               // Update background style loading, returns style set once loaded and activated
 
 // Tooltips management functions
 RAYGUIAPI void GuiEnableTooltip(void);                          // Enable gui tooltips (global state)
 RAYGUIAPI void GuiDisableTooltip(void);                         // Disable gui tooltips (global state)
 RAYGUIAPI void GuiSetTooltip(const char *tooltip);              // Set tooltip string
 
+// Draw commands functions (RAYGUI_COMMAND_LIST)
+RAYGUIAPI void GuiSetDrawCommandsCallback(GuiDrawCommandsCallback callback); // Set custom callback to process draw commands on flush
+RAYGUIAPI const GuiDrawCommand *GuiGetDrawCommands(int *count); // Get draw commands recorded since last flush
+RAYGUIAPI void GuiFlush(void);                                  // Submit recorded draw commands to backend and clear list
+RAYGUIAPI const Rectangle *GuiEndFrame(int *count);             // End gui frame, get regions damaged since previous frame (NULL if not tracked)
+
+// Text buffer functions (GuiTextBoxEx)
+RAYGUIAPI GuiTextBuffer GuiLoadTextBuffer(const char *text, int capacity); // Load text buffer for editing, capacity grows as required
+RAYGUIAPI void GuiUnloadTextBuffer(GuiTextBuffer buffer);       // Unload text buffer
+RAYGUIAPI GuiTextView GuiGetTextBufferView(GuiTextBuffer buffer, int position, int size); // Get text buffer range (no text copy)
+RAYGUIAPI GuiTextView GuiGetTextBufferLine(GuiTextBuffer buffer, int line); // Get text buffer line, without line break (no text copy)
+
 // Icons functionality
 RAYGUIAPI const char *GuiIconText(int iconId, const char *text); // Get text with icon id prepended (if supported)
 #if !defined(RAYGUI_NO_ICONS)
@@ -725,6 +895,7 @@ RAYGUIAPI int GuiDropdownBox(Rectangle bounds, const char *text, int *active, bo
 RAYGUIAPI int GuiSpinner(Rectangle bounds, const char *text, int *value, int minValue, int maxValue, bool editMode); // Spinner control
 RAYGUIAPI int GuiValueBox(Rectangle bounds, const char *text, int *value, int minValue, int maxValue, bool editMode); // Value Box control, updates input text with numbers
 RAYGUIAPI int GuiTextBox(Rectangle bounds, char *text, int textSize, bool editMode);                   // Text Box control, updates input text
+RAYGUIAPI int GuiTextBoxEx(Rectangle bounds, GuiTextBuffer *buffer, bool editMode);                    // Text Box control with text buffer, supports large multiline text
 
 RAYGUIAPI int GuiSlider(Rectangle bounds, const char *textLeft, const char *textRight, float *value, float minValue, float maxValue); // Slider control
 RAYGUIAPI int GuiSliderBar(Rectangle bounds, const char *textLeft, const char *textRight, float *value, float minValue, float maxValue); // Slider Bar control
@@ -1035,6 +1206,44 @@ typedef enum {
 #include <stdarg.h>             // Required for: va_list, va_start(), vfprintf(), va_end() [TextFormat()]
 #include <math.h>               // Required for: roundf() [GuiColorPicker()]
 
+#if !defined(RAYGUI_STYLE_ASYNC_NO_THREADS)
+    #if defined(_WIN32)
+        // NOTE: windows.h is not included to avoid conflicts with raylib symbols,
+        // CloseHandle() is only declared if windows.h has not been included before
+        #include <process.h>    // Required for: _beginthreadex() [GuiLoadStyleAsync()]
+        #include <stdint.h>     // Required for: uintptr_t
+        #if !defined(_WINDOWS_)
+            #if defined(__cplusplus)
+            extern "C" {        // Prevents name mangling of Win32 functions
+            #endif
+            __declspec(dllimport) int __stdcall CloseHandle(void *handle);
+            #if defined(__cplusplus)
+            }
+            #endif
+        #endif
+    #else
+        #include <pthread.h>    // Required for: pthread_create(), pthread_detach() [GuiLoadStyleAsync()]
+    #endif
+#endif
+
+#if !defined(RAYGUI_STYLE_NO_MMAP) && !defined(_WIN32)
+    #define RAYGUI_STYLE_MMAP
+    #include <sys/mman.h>       // Required for: mmap(), munmap() [GuiLoadStyle()]
+    #include <sys/stat.h>       // Required for: fstat() [GuiLoadStyle()]
+    #include <fcntl.h>          // Required for: open() [GuiLoadStyle()]
+    #include <unistd.h>         // Required for: close(), read() [GuiLoadStyle()]
+#endif
+
+// Atomic access to variables shared with worker threads [GuiLoadStyleAsync()]
+#if defined(_MSC_VER)
+    #include <intrin.h>
+    #define RAYGUI_ATOMIC_STORE(ptr, value)     _InterlockedExchange((long volatile *)(ptr), (long)(value))
+    #define RAYGUI_ATOMIC_LOAD(ptr)             _InterlockedCompareExchange((long volatile *)(ptr), 0, 0)
+#else
+    #define RAYGUI_ATOMIC_STORE(ptr, value)     __atomic_store_n((ptr), (value), __ATOMIC_RELEASE)
+    #define RAYGUI_ATOMIC_LOAD(ptr)             __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#endif
+
 #ifdef __cplusplus
     #define RAYGUI_CLITERAL(name) name
 #else
@@ -1046,6 +1255,10 @@ typedef enum {
     #define CHECK_BOUNDS_ID(src, dst) ((src.x == dst.x) && (src.y == dst.y) && (src.width == dst.width) && (src.height == dst.height))
 #endif
 
+#if !defined(RAYGUI_NO_ICONS) && defined(RAYGUI_ICON_ATLAS)
+    #define RAYGUI_ICONS_ATLAS_COLUMNS     16      // Number of icons per row in icons atlas texture
+#endif
+
 #if !defined(RAYGUI_NO_ICONS) && !defined(RAYGUI_CUSTOM_ICONS)
 
 // Embedded icons, no external file provided
@@ -1339,11 +1552,49 @@ static unsigned int *guiIconsPtr = guiIcons;
     #define RAYGUI_ICON_SIZE             0
 #endif
 
-// WARNING: Those values define the total size of the style data array,
-// if changed, previous saved styles could become incompatible
-#define RAYGUI_MAX_CONTROLS             16      // Maximum number of controls
-#define RAYGUI_MAX_PROPS_BASE           16      // Maximum number of base properties
-#define RAYGUI_MAX_PROPS_EXTENDED        8      // Maximum number of extended properties
+#define RAYGUI_GLYPH_TABLE_DENSE_SIZE  256      // Number of codepoints with direct glyph lookup (ASCII and Latin-1)
+
+// NOTE: One lookup table for every font kept in fonts cache (RAYGUI_FONT_CACHE_SIZE),
+// all provided styles (12) can be resident as style sets without regenerating tables
+#if !defined(RAYGUI_GLYPH_TABLE_CACHE_SIZE)
+    #define RAYGUI_GLYPH_TABLE_CACHE_SIZE    16     // Number of fonts glyphs lookup tables kept (style sets fonts)
+#endif
+
+#if !defined(RAYGUI_TEXT_LAYOUT_CACHE_SIZE)
+    #define RAYGUI_TEXT_LAYOUT_CACHE_SIZE   16      // Number of word-wrap text layouts kept in cache
+#endif
+
+#if !defined(RAYGUI_TEXT_MEASURE_CACHE_SIZE)
+    #define RAYGUI_TEXT_MEASURE_CACHE_SIZE  64      // Number of text widths kept in measure cache
+#endif
+
+#if !defined(RAYGUI_TEXT_BUFFER_GAP_SIZE)
+    #define RAYGUI_TEXT_BUFFER_GAP_SIZE    256      // Text buffer minimum gap size on loading
+#endif
+
+#if !defined(RAYGUI_TEXTBOX_MAX_INPUT_SIZE)
+    #define RAYGUI_TEXTBOX_MAX_INPUT_SIZE  256      // Maximum size in bytes of text input processed per frame (GuiTextBox(), GuiTextBoxEx())
+#endif
+
+#if !defined(RAYGUI_TEXTBOX_AUTO_CURSOR_COOLDOWN_SECONDS)
+    #define RAYGUI_TEXTBOX_AUTO_CURSOR_COOLDOWN_SECONDS   0.66f     // Time to wait for autocursor movement (seconds)
+#endif
+#if !defined(RAYGUI_TEXTBOX_AUTO_CURSOR_DELAY_SECONDS)
+    #define RAYGUI_TEXTBOX_AUTO_CURSOR_DELAY_SECONDS      0.0166f   // Time delay between autocursor movements (seconds)
+#endif
+#if !defined(RAYGUI_TEXTBOX_AUTO_CURSOR_MAX_BACKLOG_SECONDS)
+    #define RAYGUI_TEXTBOX_AUTO_CURSOR_MAX_BACKLOG_SECONDS  0.25f   // Maximum autocursor time accumulated, frame hitches do not repeat more
+#endif
+
+#if !defined(RAYGUI_STYLE_STACK_SIZE)
+    #define RAYGUI_STYLE_STACK_SIZE         16      // Maximum number of style properties pushed with GuiPushStyle()
+#endif
+
+#if !defined(RAYGUI_FONT_CACHE_SIZE)
+    #define RAYGUI_FONT_CACHE_SIZE          16      // Maximum number of fonts loaded by styles kept in cache
+#endif
+
+#define RAYGUI_HASH_SEED    14695981039346656037ULL // Hash initial value (FNV-1a offset basis)
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -1351,16 +1602,167 @@ static unsigned int *guiIconsPtr = guiIcons;
 // Gui control property style color element
 typedef enum { BORDER = 0, BASE, TEXT, OTHER } GuiPropertyElement;
 
+// Gui font glyphs lookup table
+// NOTE: First codepoints (ASCII and Latin-1) are mapped directly,
+// higher codepoints are mapped using an open-addressing hash table
+// NOTE: Font is identified by glyphs address, glyphs count, texture id and base size, so a font
+// unloaded and a new font loaded at the same glyphs address is not mistaken for the previous one
+typedef struct GuiGlyphTable {
+    const GlyphInfo *glyphs;    // Font glyphs used to generate the table (font identifier)
+    int glyphCount;             // Font glyphs count (font identifier)
+    unsigned int textureId;     // Font texture id (font identifier)
+    int baseSize;               // Font base size (font identifier)
+    int fallbackIndex;          // Glyph index returned for not found codepoints ('?' glyph)
+    int dense[RAYGUI_GLYPH_TABLE_DENSE_SIZE];   // Glyph index by codepoint, direct lookup
+    int *sparse;                // Codepoint and glyph index pairs, hash lookup (open addressing)
+    int sparseCapacity;         // Hash lookup capacity, in pairs (power of two)
+    float *advances;            // Glyph advance by glyph index, scaled for textSize
+    int textSize;               // Text size used to scale glyph advances
+} GuiGlyphTable;
+
+// Gui text layout, word-wrap line breaks for one line of text
+typedef struct GuiTextLayout {
+    unsigned long long hash;    // Text hash, including layout parameters
+    int size;                   // Text size in bytes
+    int *breaks;                // Line breaks, byte offsets where a new wrapped line starts
+    int breakCount;             // Line breaks count
+    int breakCapacity;          // Line breaks allocated capacity
+    unsigned int lastUsed;      // Last usage counter, used to replace least recently used layout
+} GuiTextLayout;
+
+// Gui text measure, cached text width
+typedef struct GuiTextMeasure {
+    unsigned long long hash;    // Text hash, including font and text style
+    int size;                   // Text size in bytes (-1 if entry is not valid)
+    float width;                // Text width measured
+    unsigned int lastUsed;      // Last usage counter, used to replace least recently used measure
+} GuiTextMeasure;
+
+// Gui draw item, draw commands recorded by one drawing primitive (rectangle with borders, text, single command)
+// NOTE: Used for damaged regions tracking (RAYGUI_COMMAND_LIST)
+typedef struct GuiDrawItem {
+    unsigned long long key;     // Item identity: primitive kind and rectangle hash
+    unsigned long long hash;    // Item content: draw commands hash, including previous item identity (drawing order)
+    Rectangle bounds;           // Item pixels bounds, integer aligned (empty if no commands)
+    bool matched;               // Previous frame item matched by a current frame item [GuiEndFrame()]
+} GuiDrawItem;
+
+// Gui control style, resolved from style properties for drawing
+// NOTE: Properties values include DEFAULT base properties inherited and style overrides pushed,
+// colors are converted from hexadecimal values and already include global alpha (guiAlpha),
+// colors array is indexed by base color properties (BORDER_COLOR_NORMAL..TEXT_COLOR_DISABLED)
+typedef struct GuiControlStyle {
+    int props[RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED];  // Control properties values (base and extended)
+    Color colors[12];           // Control border, base and text colors for every state
+    Color lineColor;            // Line color (DEFAULT specific property)
+    Color backgroundColor;      // Background color (DEFAULT specific property)
+} GuiControlStyle;
+
+// Gui style data, style loaded from file before being applied
+// NOTE: Loading style data does not require GPU access, font atlas image is uploaded when applied
+typedef struct GuiStyleData {
+    GuiStyleProp *props;        // Style properties loaded
+    int propertyCount;          // Style properties count
+    Font font;                  // Style font (recs and glyphs, texture not loaded)
+    Image fontImage;            // Style font atlas image (uncompressed)
+    Rectangle fontWhiteRec;     // Style font white rectangle, used for shapes drawing
+    unsigned long long fontKey; // Style font key, hash of font data (font cache)
+    bool inPlace;               // Style properties, font recs and font image are used in place from file data
+    unsigned char *fileData;    // Style file data owned by style data (loaded with GuiLoadStyleFile())
+    int fileDataSize;           // Style file data size
+} GuiStyleData;
+
+// Gui font cache entry, font loaded by styles
+// NOTE: Fonts are shared by styles loading the same font, fonts not referenced by any
+// style are kept loaded until cache is full, least recently used font is unloaded first
+typedef struct GuiFontCacheEntry {
+    unsigned long long key;     // Font key: hash of font file, size and codepoints or hash of style font data
+    Font font;                  // Font loaded (texture.id == 0 if entry not used)
+    int refCount;               // Font references, style sets using the font
+    unsigned int lastUsed;      // Last usage counter, used to unload least recently used font
+    unsigned char *fileData;    // Style file data, kept while font recs are used in place (aligned binary style)
+    int fileDataSize;           // Style file data size
+} GuiFontCacheEntry;
+
+// Gui style background loader state
+typedef enum {
+    GUI_STYLE_LOADER_IDLE = 0,  // No style loading
+    GUI_STYLE_LOADER_LOADING,   // Style data loading (worker thread)
+    GUI_STYLE_LOADER_LOADED,    // Style data loaded, waiting to be applied by GuiUpdateStyleAsync()
+    GUI_STYLE_LOADER_FAILED,    // Style data could not be loaded, waiting to be reported by GuiUpdateStyleAsync()
+} GuiStyleLoaderState;
+
+// Gui style background loader
+typedef struct GuiStyleLoader {
+    char fileName[512];         // Style file name
+    GuiStyleData data;          // Style data loaded (text style file data kept in data.fileData)
+    bool textStyle;             // Style file is a text style (.rgs), parsed when applied
+    void (*callback)(GuiStyleSet *set);    // Style loaded callback, called once style set is activated
+    volatile int state;         // Loader state (GuiStyleLoaderState), shared with worker thread
+} GuiStyleLoader;
+
+// Gui style bundle index entry, style stored in bundle
+// NOTE: Same layout as bundle file index entry (48 bytes)
+typedef struct GuiStyleBundleEntry {
+    char name[32];              // Style name, NULL terminated
+    int dataOffset;             // Style data offset in bundle file, aligned to 16 bytes
+    int dataSize;               // Style data size, aligned binary style (version 500)
+    int compDataSize;           // Style data size stored in bundle (compressed)
+    int compression;            // Style data compression: 0-None, 1-DEFLATE
+} GuiStyleBundleEntry;
+
+// Gui style bundle, styles loaded on request from bundle file (.rgsb)
+typedef struct GuiStyleBundle {
+    GuiStyleBundleEntry *entries;   // Styles index
+    int entryCount;             // Styles count
+    unsigned char *fileData;    // Bundle file data (memory mapped), styles data read from file if not available
+    int fileDataSize;           // Bundle file data size
+    char fileName[512];         // Bundle file name, styles data read from file if not memory mapped
+} GuiStyleBundle;
+
+// Gui style property override, temporary value pushed with GuiPushStyle()
+typedef struct GuiStyleOverride {
+    int control;                // Control overridden (DEFAULT overrides base property for all controls)
+    int property;               // Property overridden
+    int value;                  // Property value while override is in stack
+} GuiStyleOverride;
+
+// Gui text box index, prefix widths for text box on edit mode
+// NOTE: widths[i] is the width of text up to byte i, bytes inside a codepoint
+// share the width of the codepoint first byte, so widths array is monotonic
+typedef struct GuiTextBoxIndex {
+    const char *text;           // Text indexed (user provided buffer)
+    int length;                 // Text length in bytes
+    unsigned long long hash;    // Text hash, used to detect external text changes
+    int textSize;               // Text size used to measure widths
+    int textSpacing;            // Text spacing used to measure widths
+    float *widths;              // Text prefix widths (length + 1)
+    int capacity;               // Text prefix widths allocated capacity
+} GuiTextBoxIndex;
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
 static GuiState guiState = STATE_NORMAL;        // Gui global state, if !STATE_NORMAL, forces defined state
 
 static Font guiFont = { 0 };                    // Gui current font (WARNING: highly coupled to raylib)
+static GuiGlyphTable guiGlyphTables[RAYGUI_GLYPH_TABLE_CACHE_SIZE] = { 0 };   // Gui fonts glyphs lookup tables (style sets fonts)
+static GuiGlyphTable *guiGlyphTable = &guiGlyphTables[0];  // Gui current font glyphs lookup table
+static unsigned int guiGlyphTablesCounter = 0;  // Gui glyphs lookup tables replacement counter
+static GuiTextLayout guiTextLayouts[RAYGUI_TEXT_LAYOUT_CACHE_SIZE] = { 0 }; // Gui word-wrap text layouts cache
+static unsigned int guiTextLayoutsCounter = 0;  // Gui text layouts usage counter
+static GuiTextMeasure guiTextMeasures[RAYGUI_TEXT_MEASURE_CACHE_SIZE] = { 0 }; // Gui text measures cache
+static unsigned int guiTextMeasuresCounter = 0; // Gui text measures usage counter
+static unsigned int guiTextMeasuresHits = 0;    // Gui text measures cache hits
+static unsigned int guiTextMeasuresMisses = 0;  // Gui text measures cache misses
 static bool guiLocked = false;                  // Gui lock state (no inputs processed)
 static float guiAlpha = 1.0f;                   // Gui controls transparency
 
 static unsigned int guiIconScale = 1;           // Gui icon default scale (if icons enabled)
+#if !defined(RAYGUI_NO_ICONS) && defined(RAYGUI_ICON_ATLAS)
+static Texture2D guiIconsAtlas = { 0 };         // Gui icons atlas texture, generated from icons data
+static bool guiIconsAtlasDirty = true;          // Gui icons atlas requires regeneration (icons data changed)
+#endif
 
 static bool guiTooltip = false;                 // Tooltip enabled/disabled
 static const char *guiTooltipPtr = NULL;        // Tooltip string pointer (string provided by user)
@@ -1369,9 +1771,11 @@ static bool guiSliderDragging = false;          // Gui slider drag state (no inp
 static Rectangle guiSliderActive = { 0 };       // Gui slider active bounds rectangle, used as an unique identifier
 
 static int textBoxCursorIndex = 0;              // Cursor index, shared by all GuiTextBox*()
+static GuiTextBoxIndex guiTextBoxIndex = { 0 }; // Prefix widths index, shared by all GuiTextBox*()
 //static int blinkCursorFrameCounter = 0;       // Frame counter for cursor blinking
-static int autoCursorCooldownCounter = 0;       // Cooldown frame counter for automatic cursor movement on key-down
-static int autoCursorDelayCounter = 0;          // Delay frame counter for automatic cursor movement
+static float autoCursorCooldownTime = 0.0f;     // Cooldown time for automatic cursor movement on key-down (seconds)
+static float autoCursorDelayTime = 0.0f;        // Delay time for automatic cursor movement (seconds)
+static int autoCursorRepeatCount = 0;           // Automatic cursor movements for current frame
 
 //----------------------------------------------------------------------------------
 // Style data array for all gui style properties (allocated on data segment by default)
@@ -1383,11 +1787,102 @@ static int autoCursorDelayCounter = 0;          // Delay frame counter for autom
 // NOTE 2: A new style set could be loaded over this array using GuiLoadStyle(),
 // but default gui style could always be recovered with GuiLoadStyleDefault()
 //
+// NOTE 3: Style data array used is the one of the active style set, GuiSetStyleSet()
+// changes the active style set, global default style set is used if none set
+//
 // guiStyle size is by default: 16*(16 + 8) = 384*4 = 1536 bytes = 1.5 KB
 //----------------------------------------------------------------------------------
-static unsigned int guiStyle[RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)] = { 0 };
+static GuiStyleSet guiStyleSetDefault = { 0 };     // Gui default style set, used if no other style set is active
+static GuiStyleSet *guiStyleSet = &guiStyleSetDefault;  // Gui active style set, guiStyle properties array
+
+// Gui style overrides stack, checked before guiStyle on GuiGetStyle()
+// NOTE: Overrides never modify guiStyle array, so temporary style changes do not require
+// saving and restoring properties or propagating DEFAULT properties to all controls
+static GuiStyleOverride guiStyleStack[RAYGUI_STYLE_STACK_SIZE] = { 0 };
+static int guiStyleStackCount = 0;          // Style overrides pushed (could be bigger than stack size)
+
+static GuiStyleLoader guiStyleLoader = { 0 };   // Gui style background loader (GuiLoadStyleAsync())
+static GuiStyleBundle guiStyleBundle = { 0 };   // Gui style bundle (GuiLoadStyleBundle())
+
+static GuiFontCacheEntry guiFontCache[RAYGUI_FONT_CACHE_SIZE] = { 0 };  // Gui fonts loaded by styles, reference counted
+static unsigned int guiFontCacheCounter = 0;    // Gui font cache usage counter
+
+// Gui default style properties (LIGHT style), resolved values and controls overriding DEFAULT base properties
+// NOTE: Generated with GuiExportStyleAsCode(), loading default style only requires a values copy
+static const unsigned int guiStyleDefaultProps[RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)] = {
+    0x838383ff, 0xc9c9c9ff, 0x686868ff, 0x5bb2d9ff, 0xc9effeff, 0x6c9bbcff, 0x0492c7ff, 0x97e8ffff, 0x368bafff, 0xb5c1c2ff, 0xe6e9e9ff, 0xaeb7b8ff, 0x00000001, 0x00000000, 0x00000001, 0x00000000, 0x0000000a, 0x00000001, 0x90abb5ff, 0xf5f5f5ff, 0x0000000f, 0x00000001, 0x00000000, 0x00000000,    // DEFAULT
+    0x838383ff, 0xc9c9c9ff, 0x686868ff, 0x5bb2d9ff, 0xc9effeff, 0x6c9bbcff, 0x0492c7ff, 0x97e8ffff, 0x368bafff, 0xb5c1c2ff, 0xe6e9e9ff, 0xaeb7b8ff, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,    // LABEL
+    0x838383ff, 0xc9c9c9ff, 0x686868ff, 0x5bb2d9ff, 0xc9effeff, 0x6c9bbcff, 0x0492c7ff, 0x97e8ffff, 0x368bafff, 0xb5c1c2ff, 0xe6e9e9ff, 0xaeb7b8ff, 0x00000002, 0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,    // BUTTON
+    0x838383ff, 0xc9c9c9ff, 0x686868ff, 0x5bb2d9ff, 0xc9effeff, 0x6c9bbcff, 0x0492c7ff, 0x97e8ffff, 0x368bafff, 0xb5c1c2ff, 0xe6e9e9ff, 0xaeb7b8ff, 0x00000001, 0x00000000, 0x00000001, 0x00000000, 0x00000002, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,    // TOGGLE
+    0x838383ff, 0xc9c9c9ff, 0x686868ff, 0x5bb2d9ff, 0xc9effeff, 0x6c9bbcff, 0x0492c7ff, 0x97e8ffff, 0x368bafff, 0xb5c1c2ff, 0xe6e9e9ff, 0xaeb7b8ff, 0x00000001, 0x00000004, 0x00000001, 0x00000000, 0x00000010, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,    // SLIDER
+    0x838383ff, 0xc9c9c9ff, 0x686868ff, 0x5bb2d9ff, 0xc9effeff, 0x6c9bbcff, 0x0492c7ff, 0x97e8ffff, 0x368bafff, 0xb5c1c2ff, 0xe6e9e9ff, 0xaeb7b8ff, 0x00000001, 0x00000004, 0x00000001, 0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,    // PROGRESSBAR
+    0x838383ff, 0xc9c9c9ff, 0x686868ff, 0x5bb2d9ff, 0xc9effeff, 0x6c9bbcff, 0x0492c7ff, 0x97e8ffff, 0x368bafff, 0xb5c1c2ff, 0xe6e9e9ff, 0xaeb7b8ff, 0x00000001, 0x00000004, 0x00000002, 0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,    // CHECKBOX
+    0x838383ff, 0xc9c9c9ff, 0x686868ff, 0x5bb2d9ff, 0xc9effeff, 0x6c9bbcff, 0x0492c7ff, 0x97e8ffff, 0x368bafff, 0xb5c1c2ff, 0xe6e9e9ff, 0xaeb7b8ff, 0x00000001, 0x00000000, 0x00000001, 0x00000000, 0x00000020, 0x00000002, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,    // COMBOBOX
+    0x838383ff, 0xc9c9c9ff, 0x686868ff, 0x5bb2d9ff, 0xc9effeff, 0x6c9bbcff, 0x0492c7ff, 0x97e8ffff, 0x368bafff, 0xb5c1c2ff, 0xe6e9e9ff, 0xaeb7b8ff, 0x00000001, 0x00000000, 0x00000001, 0x00000000, 0x00000010, 0x00000002, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,    // DROPDOWNBOX
+    0x838383ff, 0xc9c9c9ff, 0x686868ff, 0x5bb2d9ff, 0xc9effeff, 0x6c9bbcff, 0x0492c7ff, 0x97e8ffff, 0x368bafff, 0xb5c1c2ff, 0xe6e9e9ff, 0xaeb7b8ff, 0x00000001, 0x00000004, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,    // TEXTBOX
+    0x838383ff, 0xc9c9c9ff, 0x686868ff, 0x5bb2d9ff, 0xc9effeff, 0x6c9bbcff, 0x0492c7ff, 0x97e8ffff, 0x368bafff, 0xb5c1c2ff, 0xe6e9e9ff, 0xaeb7b8ff, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,    // VALUEBOX
+    0x838383ff, 0xc9c9c9ff, 0x686868ff, 0x5bb2d9ff, 0xc9effeff, 0x6c9bbcff, 0x0492c7ff, 0x97e8ffff, 0x368bafff, 0xb5c1c2ff, 0xe6e9e9ff, 0xaeb7b8ff, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000018, 0x00000002, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,    // SPINNER
+    0x838383ff, 0xc9c9c9ff, 0x686868ff, 0x5bb2d9ff, 0xc9effeff, 0x6c9bbcff, 0x0492c7ff, 0x97e8ffff, 0x368bafff, 0xb5c1c2ff, 0xe6e9e9ff, 0xaeb7b8ff, 0x00000001, 0x00000000, 0x00000001, 0x00000000, 0x0000001c, 0x00000002, 0x0000000c, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000,    // LISTVIEW
+    0x838383ff, 0xc9c9c9ff, 0x686868ff, 0x5bb2d9ff, 0xc9effeff, 0x6c9bbcff, 0x0492c7ff, 0x97e8ffff, 0x368bafff, 0xb5c1c2ff, 0xe6e9e9ff, 0xaeb7b8ff, 0x00000001, 0x00000000, 0x00000001, 0x00000000, 0x00000008, 0x00000010, 0x00000008, 0x00000008, 0x00000002, 0x00000000, 0x00000000, 0x00000000,    // COLORPICKER
+    0x838383ff, 0xc9c9c9ff, 0x686868ff, 0x5bb2d9ff, 0xc9effeff, 0x6c9bbcff, 0x0492c7ff, 0x97e8ffff, 0x368bafff, 0xb5c1c2ff, 0xe6e9e9ff, 0xaeb7b8ff, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x00000006, 0x00000000, 0x00000000, 0x00000010, 0x00000000, 0x0000000c, 0x00000000, 0x00000000,    // SCROLLBAR
+    0x838383ff, 0xc9c9c9ff, 0x686868ff, 0x5bb2d9ff, 0xc9effeff, 0x6c9bbcff, 0x0492c7ff, 0x97e8ffff, 0x368bafff, 0xb5c1c2ff, 0xe6e9e9ff, 0xaeb7b8ff, 0x00000001, 0x00000008, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000    // STATUSBAR
+};
+static const unsigned int guiStyleDefaultOverrides[RAYGUI_MAX_PROPS_BASE] = {
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00004004, 0x00008270, 0x00008e42, 0x00000000
+};
+
+// Gui controls resolved styles, only rebuilt when required (style properties or global alpha changed)
+static GuiControlStyle guiControlStyles[RAYGUI_MAX_CONTROLS] = { 0 };
+static bool guiControlStylesValid[RAYGUI_MAX_CONTROLS] = { 0 };
+
+#if defined(RAYGUI_COMMAND_LIST)
+//----------------------------------------------------------------------------------
+// Draw commands list, all gui drawing is recorded into it until GuiFlush() is called
+//
+// NOTE: In case list gets full before GuiFlush(), recorded commands are submitted and list cleared
+//
+// guiDrawCommands size is by default: 4096*sizeof(GuiDrawCommand) = 4096*44 = 180224 bytes = 176 KB
+//----------------------------------------------------------------------------------
+#if !defined(RAYGUI_MAX_DRAW_COMMANDS)
+    #define RAYGUI_MAX_DRAW_COMMANDS     4096       // Maximum number of draw commands recorded between flushes
+#endif
+
+static GuiDrawCommand guiDrawCommands[RAYGUI_MAX_DRAW_COMMANDS] = { 0 };
+static int guiDrawCommandCount = 0;                             // Draw commands recorded count
+static GuiDrawCommandsCallback guiDrawCommandsCallback = NULL;  // Draw commands custom processing callback
+
+//----------------------------------------------------------------------------------
+// Draw items, draw commands recorded per frame grouped by drawing primitive, used to get damaged regions
+//
+// NOTE 1: Items are identified by primitive kind and rectangle (control bounds, text bounds...),
+// so they are matched between frames even if other items are added or removed
+//
+// NOTE 2: Previous and current frame items are kept, GuiEndFrame() compares them and swaps frames
+//
+// guiDrawItems size is by default: 2*2048*sizeof(GuiDrawItem) = 2*2048*40 = 163840 bytes = 160 KB
+//----------------------------------------------------------------------------------
+#if !defined(RAYGUI_MAX_DRAW_ITEMS)
+    #define RAYGUI_MAX_DRAW_ITEMS        2048       // Maximum number of draw items tracked per frame, whole frame damaged if exceeded
+#endif
+#if !defined(RAYGUI_MAX_DAMAGE_RECS)
+    #define RAYGUI_MAX_DAMAGE_RECS         32       // Maximum number of damaged rectangles reported per frame
+#endif
 
-static bool guiStyleLoaded = false;         // Style loaded flag for lazy style initialization
+static GuiDrawItem guiDrawItems[2][RAYGUI_MAX_DRAW_ITEMS] = { 0 };  // Draw items, previous and current frame
+static int guiDrawItemCount[2] = { 0 };                         // Draw items count, previous and current frame
+static int guiDrawItemFrame = 0;                                // Current frame draw items index
+static GuiDrawItem *guiDrawItemActive = NULL;                   // Draw item receiving recorded commands
+static int guiDrawItemLookup[2*RAYGUI_MAX_DRAW_ITEMS] = { 0 };  // Previous frame items lookup by identity (open addressing, index + 1)
+#if defined(RAYGUI_DAMAGE_TRACKING)
+static bool guiDamageTracking = true;                           // Draw items tracked, enabled from first frame
+#else
+static bool guiDamageTracking = false;                          // Draw items tracked, enabled on first GuiEndFrame() call
+#endif
+static bool guiDamageFull = false;                              // Whole frame damaged (items overflow, commands list full, icons changed)
+static Rectangle guiDamageRecs[RAYGUI_MAX_DAMAGE_RECS] = { 0 }; // Damaged rectangles, integer aligned and not overlapping
+static int guiDamageRecCount = 0;                               // Damaged rectangles count
+#endif
 
 //----------------------------------------------------------------------------------
 // Standalone Mode Functions Declaration
@@ -1403,9 +1898,16 @@ static bool guiStyleLoaded = false;         // Style loaded flag for lazy style
 #define KEY_UP              265
 #define KEY_BACKSPACE       259
 #define KEY_ENTER           257
+#define KEY_DELETE          261
+#define KEY_HOME            268
+#define KEY_END             269
+#define KEY_LEFT_SHIFT      340
+#define KEY_LEFT_CONTROL    341
 
 #define MOUSE_LEFT_BUTTON     0
 
+#define BLANK   RAYGUI_CLITERAL(Color){ 0, 0, 0, 0 }    // Blank (Transparent)
+
 // Input required functions
 //-------------------------------------------------------------------------------
 static Vector2 GetMousePosition(void);
@@ -1417,12 +1919,18 @@ static bool IsMouseButtonReleased(int button);
 static bool IsKeyDown(int key);
 static bool IsKeyPressed(int key);
 static int GetCharPressed(void);         // -- GuiTextBox(), GuiValueBox()
+static float GetFrameTime(void);         // -- GuiTextBox(), key repeat timing
+static int GetScreenWidth(void);         // -- GuiTabBar(), GuiTooltip()
 //-------------------------------------------------------------------------------
 
 // Drawing required functions
 //-------------------------------------------------------------------------------
 static void DrawRectangle(int x, int y, int width, int height, Color color);        // -- GuiDrawRectangle()
 static void DrawRectangleGradientEx(Rectangle rec, Color col1, Color col2, Color col3, Color col4); // -- GuiColorPicker()
+static void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint); // -- GuiDrawText(), GuiDrawIcon()
+#if defined(RAYGUI_ICON_ATLAS)
+#define PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA     2
+#endif
 //-------------------------------------------------------------------------------
 
 // Text required functions
@@ -1430,8 +1938,13 @@ static void DrawRectangleGradientEx(Rectangle rec, Color col1, Color col2, Color
 static Font GetFontDefault(void);                            // -- GuiLoadStyleDefault()
 static Font LoadFontEx(const char *fileName, int fontSize, int *codepoints, int codepointCount); // -- GuiLoadStyle(), load font
 
+static Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing);   // -- GuiTooltip()
+
 static Texture2D LoadTextureFromImage(Image image);          // -- GuiLoadStyle(), required to load texture from embedded font atlas image
+static void UnloadTexture(Texture2D texture);                // -- GuiUnloadStyle(), GuiDrawIcon(), required to unload style fonts and regenerate icons atlas
 static void SetShapesTexture(Texture2D tex, Rectangle rec);  // -- GuiLoadStyle(), required to set shapes rec to font white rec (optimization)
+static Texture2D GetShapesTexture(void);                     // -- GuiSetStyleSet(), required to keep style set shapes texture
+static Rectangle GetShapesTextureRectangle(void);            // -- GuiSetStyleSet(), required to keep style set shapes rec
 
 static char *LoadFileText(const char *fileName);             // -- GuiLoadStyle(), required to load charset data
 static void UnloadFileText(char *text);                      // -- GuiLoadStyle(), required to unload charset data
@@ -1454,9 +1967,11 @@ static const char **TextSplit(const char *text, char delimiter, int *count);
 static int TextToInteger(const char *text);         // Get integer value from text
 
 static int GetCodepointNext(const char *text, int *codepointSize);  // Get next codepoint in a UTF-8 encoded text
+static int GetCodepointPrevious(const char *text, int *codepointSize);  // Get previous codepoint in a UTF-8 encoded text
 static const char *CodepointToUTF8(int codepoint, int *byteSize);   // Encode codepoint into UTF-8 text (char array size returned as parameter)
 
-static void DrawRectangleGradientV(int posX, int posY, int width, int height, Color color1, Color color2);  // Draw rectangle vertical gradient
+static Color Fade(Color color, float alpha);        // Get color with alpha applied, alpha goes from 0.0f to 1.0f
+
 //-------------------------------------------------------------------------------
 
 #endif      // RAYGUI_STANDALONE
@@ -1465,14 +1980,87 @@ static void DrawRectangleGradientV(int posX, int posY, int width, int height, Co
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static void GuiLoadStyleFromMemory(const unsigned char *fileData, int dataSize);    // Load style from memory (binary only)
+static void GuiLoadStyleFromText(const char *text, int textSize, const char *fileName);  // Load style from text data (.txt.rgs)
+static void GuiLoadStyleFont(const char *fileName, int fontSize, const char *charmapFileName, const char *fontFileName); // Load style font (text style)
+static const char *GuiParseStyleValue(const char *text, const char *end, unsigned int *value); // Parse text style value token (decimal or hexadecimal)
+static bool GuiLoadStyleData(const unsigned char *fileData, int dataSize, GuiStyleData *data);  // Load style data from memory, no GPU access (binary only)
+static bool GuiLoadStyleDataAligned(const unsigned char *fileData, int dataSize, GuiStyleData *data);   // Load aligned style data from memory, used in place (binary version 500)
+static unsigned char *GuiLoadStyleFile(const char *fileName, int *dataSize);  // Load style file data, memory mapped if supported
+static void GuiUnloadStyleFile(unsigned char *fileData, int dataSize);        // Unload style file data
+static bool GuiGetCachedFont(unsigned long long key, Font *font);  // Get font from cache, reference added if found
+static bool GuiAddCachedFont(unsigned long long key, Font font, unsigned char *fileData, int fileDataSize); // Add font to cache, one reference
+static bool GuiReleaseFont(Font font);                          // Release font reference, returns false if font is not cached
+static void GuiLoadFontDefault(void);                           // Set default font as gui font, previous font released or unloaded
+static void GuiUnloadFontData(Font font);                       // Unload font texture, recs and glyphs (glyphs lookup tables invalidated)
+#if !defined(RAYGUI_STANDALONE)
+static unsigned long long GuiGetStyleFontKey(const GuiStyleData *data, int imageDataSize);   // Get style font key, hash of font data
+#endif
+static void GuiApplyStyleData(GuiStyleData *data);              // Apply style data over current style, font texture uploaded
+static void GuiUnloadStyleData(GuiStyleData *data);             // Unload style data
+static unsigned char *GuiExportStyleData(int *dataSize);        // Export current style data, aligned binary style (version 500)
+static void GuiLoadStyleAsyncData(void);                        // Load style data for background style loading (worker thread)
 
 static int GetTextWidth(const char *text);                      // Gui get text width using gui font and style
+static void GuiResetTextCache(void);                            // Gui reset text measures and layouts caches
+static void GuiUpdateTextBoxIndex(const char *text, int length);    // Update text box prefix widths index (rebuilt if required)
+static void GuiTextBoxIndexInsert(const char *text, int index, int size);   // Update text box index for text inserted
+static void GuiTextBoxIndexDelete(const char *text, int index, int size);   // Update text box index for codepoint deleted
+static int GuiTextBoxIndexSearch(float width, int maxIndex);   // Get first text box index with prefix width bigger than width
+
+static void GuiTextBufferMoveGap(GuiTextBuffer *buffer, int position);  // Move text buffer gap (cursor) to text position
+static void GuiTextBufferInsert(GuiTextBuffer *buffer, const char *text, int size);    // Insert text at text buffer gap (cursor)
+static void GuiTextBufferDelete(GuiTextBuffer *buffer, int position, int size);       // Delete text range from text buffer
+static void GuiTextBufferInsertLine(GuiTextBuffer *buffer, int line, int position);   // Insert line start position in text buffer lines
+static int GuiTextBufferCodepoint(const GuiTextBuffer *buffer, int position, int *codepointSize);  // Get codepoint at text buffer position
+static int GuiTextBufferPrevious(const GuiTextBuffer *buffer, int position);          // Get previous codepoint position in text buffer
+static int GuiTextBufferGetLine(const GuiTextBuffer *buffer, int position);           // Get text buffer line containing text position
+static int GuiTextBufferGetLineEnd(const GuiTextBuffer *buffer, int line);            // Get text buffer line end position (line break position)
+static int GuiTextBufferGetPosition(const GuiTextBuffer *buffer, int line, float width);  // Get text buffer line position closest to width
+static float GuiTextBufferGetWidth(const GuiTextBuffer *buffer, int start, int end);  // Get text buffer range width
+static const GuiControlStyle *GuiGetControlStyle(int control);  // Get control resolved style, rebuilt if required
+static unsigned int GuiGetStyleValue(int control, int property);    // Get style property value, DEFAULT base properties inherited
+static int GuiResolveStyle(int control, int property);          // Get style property value, style overrides pushed checked first
+static void GuiUpdateStyleOverrides(void);                      // Update style overrides from style properties values (resolved values)
+static unsigned int GuiLerpStyleColor(unsigned int from, unsigned int to, unsigned int factor);  // Interpolate packed style color (0xRRGGBBAA), factor [0..256]
+static Color GuiGetStyleColor(int control, int property);       // Get control style color, global alpha already applied
+static void GuiResetControlStyles(void);                        // Mark all controls resolved styles to be rebuilt
+static void GuiInvalidateControlStyles(int control, int property, int value); // Mark controls resolved styles to be rebuilt if property value changes
 static Rectangle GetTextBounds(int control, Rectangle bounds);  // Get text bounds considering control bounds
 static const char *GetTextIcon(const char *text, int *iconId);  // Get text icon if provided and move text cursor
+static int GetTextInput(char *text, int maxSize, bool multiline); // Get text input for current frame, all codepoints pressed encoded as UTF-8
+static void UpdateAutoCursor(void);                             // Update automatic cursor movement timing (key repeat)
+static int GetKeyRepeatCount(int key);                          // Get key pressed/repeated count for current frame
+static const int *GetTextLineBreaks(const char *text, int size, float width, int *count);    // Get word-wrap line breaks for one line of text (cached)
+static unsigned long long GuiHashData(const void *data, int size, unsigned long long seed);  // Get hash for provided data
 
 static void GuiDrawText(const char *text, Rectangle textBounds, int alignment, Color tint);     // Gui draw text using default font
 static void GuiDrawRectangle(Rectangle rec, int borderWidth, Color borderColor, Color color);   // Gui draw rectangle using default raygui style
 
+static void GuiDrawRectangleFill(int posX, int posY, int width, int height, Color color);     // Gui draw filled rectangle (recorded if required)
+static void GuiDrawRectangleGradient(Rectangle rec, Color col1, Color col2, Color col3, Color col4); // Gui draw gradient rectangle (recorded if required)
+static void GuiDrawGlyph(int index, Vector2 position, float fontSize, Color tint);           // Gui draw one glyph using gui font (recorded if required)
+static void GuiDrawGlyphTexture(int index, Vector2 position, float fontSize, Color tint);    // Gui draw one glyph quad from gui font atlas texture
+
+static void GuiLoadGlyphTable(void);                            // Generate glyphs lookup table for gui font
+static void GuiSelectGlyphTable(void);                          // Select glyphs lookup table for gui font, generated if required
+static int GuiGetGlyphIndex(int codepoint);                     // Get glyph index for a codepoint in gui font (using lookup table)
+static bool GuiIsGlyphTableFont(const GuiGlyphTable *table, Font font); // Check if glyphs lookup table was generated for font
+static const float *GuiGetGlyphAdvances(void);                  // Get gui font glyphs advances, scaled for current TEXT_SIZE
+#if !defined(RAYGUI_NO_ICONS)
+static void GuiDrawIconColor(int iconId, int posX, int posY, int pixelSize, Color color);    // Gui draw icon, color already includes global alpha
+static void GuiDrawIconPixels(int iconId, int posX, int posY, int pixelSize, Color color);   // Gui draw icon pixel-by-pixel using rectangles
+#if defined(RAYGUI_ICON_ATLAS)
+static void GuiDrawIconAtlas(int iconId, int posX, int posY, int pixelSize, Color color);    // Gui draw icon as a quad from icons atlas
+static void GuiLoadIconsAtlas(void);                            // Gui generate icons atlas texture from icons data
+#endif
+#endif
+#if defined(RAYGUI_COMMAND_LIST)
+static void GuiAddDrawCommand(GuiDrawCommand command);         // Add draw command to list, flushing it if full
+static void GuiBeginDrawItem(int kind, Rectangle rec);          // Begin draw item, following commands are tracked into it
+static void GuiEndDrawItem(void);                               // End draw item
+static void GuiAddDamageRec(Rectangle rec);                     // Add damaged rectangle, merged with overlapping ones
+#endif
+
 static const char **GuiTextSplit(const char *text, char delimiter, int *count, int *textRow);   // Split controls text into multiple strings
 static Vector3 ConvertHSVtoRGB(Vector3 hsv);                    // Convert color data from HSV to RGB
 static Vector3 ConvertRGBtoHSV(Vector3 rgb);                    // Convert color data from RGB to HSV
@@ -1508,7 +2096,13 @@ void GuiSetAlpha(float alpha)
     if (alpha < 0.0f) alpha = 0.0f;
     else if (alpha > 1.0f) alpha = 1.0f;
 
-    guiAlpha = alpha;
+    if (alpha != guiAlpha)
+    {
+        guiAlpha = alpha;
+
+        // Resolved styles colors include global alpha
+        GuiResetControlStyles();
+    }
 }
 
 // Set gui state (global state)
@@ -1526,9 +2120,16 @@ void GuiSetFont(Font font)
         // NOTE: If we try to setup a font but default style has not been
         // lazily loaded before, it will be overwritten, so we need to force
         // default style loading first
-        if (!guiStyleLoaded) GuiLoadStyleDefault();
+        if (!guiStyleSet->loaded) GuiLoadStyleDefault();
+
+    #if defined(RAYGUI_COMMAND_LIST)
+        // NOTE: Recorded text commands are drawn using current gui font,
+        // so they must be submitted before the font is changed
+        GuiFlush();
+    #endif
 
         guiFont = font;
+        GuiLoadGlyphTable();
     }
 }
 
@@ -1538,24 +2139,76 @@ Font GuiGetFont(void)
     return guiFont;
 }
 
+// Get gui text measure cache hits/misses counters
+// NOTE: Useful to verify static UIs are not measuring text every frame
+void GuiGetTextCacheStats(unsigned int *hits, unsigned int *misses)
+{
+    if (hits != NULL) *hits = guiTextMeasuresHits;
+    if (misses != NULL) *misses = guiTextMeasuresMisses;
+}
+
 // Set control style property value
 void GuiSetStyle(int control, int property, int value)
 {
-    if (!guiStyleLoaded) GuiLoadStyleDefault();
-    guiStyle[control*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + property] = value;
+    if (!guiStyleSet->loaded) GuiLoadStyleDefault();
+    guiStyleSet->props[control*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + property] = value;
 
-    // Default properties are propagated to all controls
-    if ((control == 0) && (property < RAYGUI_MAX_PROPS_BASE))
+    // Default base properties are inherited by controls not overriding them,
+    // setting a DEFAULT property resets controls overrides, same as propagating it to all controls
+    if (property < RAYGUI_MAX_PROPS_BASE)
     {
-        for (int i = 1; i < RAYGUI_MAX_CONTROLS; i++) guiStyle[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + property] = value;
+        if (control == 0) guiStyleSet->overrides[property] = 0;
+        else guiStyleSet->overrides[property] |= (1u << control);
     }
+
+    // DEFAULT properties affect all controls resolved styles
+    if (control == 0) GuiResetControlStyles();
+    else guiControlStylesValid[control] = false;
+
+    // Text metrics changed, cached text measures are not valid anymore
+    if ((control == 0) && ((property == TEXT_SIZE) || (property == TEXT_SPACING))) GuiResetTextCache();
 }
 
 // Get control style property value
+// NOTE: Value is read from control resolved style, style overrides pushed already applied
 int GuiGetStyle(int control, int property)
 {
-    if (!guiStyleLoaded) GuiLoadStyleDefault();
-    return guiStyle[control*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + property];
+    return GuiGetControlStyle(control)->props[property];
+}
+
+// Push temporary style property value, restored with GuiPopStyle()
+// NOTE: Global style is not modified, DEFAULT base properties pushed apply to all controls
+// WARNING: Properties set with GuiSetStyle() are hidden by overrides until popped
+void GuiPushStyle(int control, int property, int value)
+{
+    if (guiStyleStackCount < RAYGUI_STYLE_STACK_SIZE)
+    {
+        // NOTE: Resolved styles are checked before the override is applied
+        GuiInvalidateControlStyles(control, property, value);
+
+        guiStyleStack[guiStyleStackCount].control = control;
+        guiStyleStack[guiStyleStackCount].property = property;
+        guiStyleStack[guiStyleStackCount].value = value;
+    }
+    else RAYGUI_LOG("WARNING: Style stack is full, style property override ignored\n");
+
+    // Counter is always incremented to keep push/pop calls balanced
+    guiStyleStackCount++;
+}
+
+// Pop last style property value pushed
+void GuiPopStyle(void)
+{
+    if (guiStyleStackCount <= 0) return;
+
+    guiStyleStackCount--;
+
+    if (guiStyleStackCount < RAYGUI_STYLE_STACK_SIZE)
+    {
+        // NOTE: Resolved styles are checked after the override is removed
+        GuiStyleOverride override = guiStyleStack[guiStyleStackCount];
+        GuiInvalidateControlStyles(override.control, override.property, override.value);
+    }
 }
 
 //----------------------------------------------------------------------------------
@@ -1594,17 +2247,15 @@ int GuiWindowBox(Rectangle bounds, const char *title)
     GuiPanel(windowPanel, NULL);    // Draw window base
 
     // Draw window close button
-    int tempBorderWidth = GuiGetStyle(BUTTON, BORDER_WIDTH);
-    int tempTextAlignment = GuiGetStyle(BUTTON, TEXT_ALIGNMENT);
-    GuiSetStyle(BUTTON, BORDER_WIDTH, 1);
-    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
+    GuiPushStyle(BUTTON, BORDER_WIDTH, 1);
+    GuiPushStyle(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
 #if defined(RAYGUI_NO_ICONS)
     result = GuiButton(closeButtonRec, "x");
 #else
     result = GuiButton(closeButtonRec, GuiIconText(ICON_CROSS_SMALL, NULL));
 #endif
-    GuiSetStyle(BUTTON, BORDER_WIDTH, tempBorderWidth);
-    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, tempTextAlignment);
+    GuiPopStyle();
+    GuiPopStyle();
     //--------------------------------------------------------------------
 
     return result;      // Window close button clicked: result = 1
@@ -1622,9 +2273,9 @@ int GuiGroupBox(Rectangle bounds, const char *text)
 
     // Draw control
     //--------------------------------------------------------------------
-    GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y, RAYGUI_GROUPBOX_LINE_THICK, bounds.height }, 0, BLANK, GetColor(GuiGetStyle(DEFAULT, (state == STATE_DISABLED)? BORDER_COLOR_DISABLED : LINE_COLOR)));
-    GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + bounds.height - 1, bounds.width, RAYGUI_GROUPBOX_LINE_THICK }, 0, BLANK, GetColor(GuiGetStyle(DEFAULT, (state == STATE_DISABLED)? BORDER_COLOR_DISABLED : LINE_COLOR)));
-    GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x + bounds.width - 1, bounds.y, RAYGUI_GROUPBOX_LINE_THICK, bounds.height }, 0, BLANK, GetColor(GuiGetStyle(DEFAULT, (state == STATE_DISABLED)? BORDER_COLOR_DISABLED : LINE_COLOR)));
+    GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y, RAYGUI_GROUPBOX_LINE_THICK, bounds.height }, 0, BLANK, GuiGetStyleColor(DEFAULT, (state == STATE_DISABLED)? BORDER_COLOR_DISABLED : LINE_COLOR));
+    GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + bounds.height - 1, bounds.width, RAYGUI_GROUPBOX_LINE_THICK }, 0, BLANK, GuiGetStyleColor(DEFAULT, (state == STATE_DISABLED)? BORDER_COLOR_DISABLED : LINE_COLOR));
+    GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x + bounds.width - 1, bounds.y, RAYGUI_GROUPBOX_LINE_THICK, bounds.height }, 0, BLANK, GuiGetStyleColor(DEFAULT, (state == STATE_DISABLED)? BORDER_COLOR_DISABLED : LINE_COLOR));
 
     GuiLine(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y - GuiGetStyle(DEFAULT, TEXT_SIZE)/2, bounds.width, (float)GuiGetStyle(DEFAULT, TEXT_SIZE) }, text);
     //--------------------------------------------------------------------
@@ -1645,7 +2296,7 @@ int GuiLine(Rectangle bounds, const char *text)
     int result = 0;
     GuiState state = guiState;
 
-    Color color = GetColor(GuiGetStyle(DEFAULT, (state == STATE_DISABLED)? BORDER_COLOR_DISABLED : LINE_COLOR));
+    Color color = GuiGetStyleColor(DEFAULT, (state == STATE_DISABLED)? BORDER_COLOR_DISABLED : LINE_COLOR);
 
     // Draw control
     //--------------------------------------------------------------------
@@ -1693,8 +2344,8 @@ int GuiPanel(Rectangle bounds, const char *text)
     //--------------------------------------------------------------------
     if (text != NULL) GuiStatusBar(statusBar, text);  // Draw panel header as status bar
 
-    GuiDrawRectangle(bounds, RAYGUI_PANEL_BORDER_WIDTH, GetColor(GuiGetStyle(DEFAULT, (state == STATE_DISABLED)? BORDER_COLOR_DISABLED: LINE_COLOR)),
-                     GetColor(GuiGetStyle(DEFAULT, (state == STATE_DISABLED)? BASE_COLOR_DISABLED : BACKGROUND_COLOR)));
+    GuiDrawRectangle(bounds, RAYGUI_PANEL_BORDER_WIDTH, GuiGetStyleColor(DEFAULT, (state == STATE_DISABLED)? BORDER_COLOR_DISABLED: LINE_COLOR),
+                     GuiGetStyleColor(DEFAULT, (state == STATE_DISABLED)? BASE_COLOR_DISABLED : BACKGROUND_COLOR));
     //--------------------------------------------------------------------
 
     return result;
@@ -1729,10 +2380,8 @@ int GuiTabBar(Rectangle bounds, const char **text, int count, int *active)
         if (tabBounds.x < GetScreenWidth())
         {
             // Draw tabs as toggle controls
-            int textAlignment = GuiGetStyle(TOGGLE, TEXT_ALIGNMENT);
-            int textPadding = GuiGetStyle(TOGGLE, TEXT_PADDING);
-            GuiSetStyle(TOGGLE, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
-            GuiSetStyle(TOGGLE, TEXT_PADDING, 8);
+            GuiPushStyle(TOGGLE, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
+            GuiPushStyle(TOGGLE, TEXT_PADDING, 8);
 
             if (i == (*active))
             {
@@ -1746,27 +2395,25 @@ int GuiTabBar(Rectangle bounds, const char **text, int count, int *active)
                 if (toggle) *active = i;
             }
 
-            GuiSetStyle(TOGGLE, TEXT_PADDING, textPadding);
-            GuiSetStyle(TOGGLE, TEXT_ALIGNMENT, textAlignment);
+            GuiPopStyle();
+            GuiPopStyle();
 
             // Draw tab close button
             // NOTE: Only draw close button for current tab: if (CheckCollisionPointRec(mousePosition, tabBounds))
-            int tempBorderWidth = GuiGetStyle(BUTTON, BORDER_WIDTH);
-            int tempTextAlignment = GuiGetStyle(BUTTON, TEXT_ALIGNMENT);
-            GuiSetStyle(BUTTON, BORDER_WIDTH, 1);
-            GuiSetStyle(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
+            GuiPushStyle(BUTTON, BORDER_WIDTH, 1);
+            GuiPushStyle(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
 #if defined(RAYGUI_NO_ICONS)
             if (GuiButton(RAYGUI_CLITERAL(Rectangle){ tabBounds.x + tabBounds.width - 14 - 5, tabBounds.y + 5, 14, 14 }, "x")) result = i;
 #else
             if (GuiButton(RAYGUI_CLITERAL(Rectangle){ tabBounds.x + tabBounds.width - 14 - 5, tabBounds.y + 5, 14, 14 }, GuiIconText(ICON_CROSS_SMALL, NULL))) result = i;
 #endif
-            GuiSetStyle(BUTTON, BORDER_WIDTH, tempBorderWidth);
-            GuiSetStyle(BUTTON, TEXT_ALIGNMENT, tempTextAlignment);
+            GuiPopStyle();
+            GuiPopStyle();
         }
     }
 
     // Draw tab-bar bottom line
-    GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + bounds.height - 1, bounds.width, 1 }, 0, BLANK, GetColor(GuiGetStyle(TOGGLE, BORDER_COLOR_NORMAL)));
+    GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + bounds.height - 1, bounds.width, 1 }, 0, BLANK, GuiGetStyleColor(TOGGLE, BORDER_COLOR_NORMAL));
     //--------------------------------------------------------------------
 
     return result;     // Return as result the current TAB closing requested
@@ -1892,17 +2539,15 @@ int GuiScrollPanel(Rectangle bounds, const char *text, Rectangle content, Vector
     //--------------------------------------------------------------------
     if (text != NULL) GuiStatusBar(statusBar, text);  // Draw panel header as status bar
 
-    GuiDrawRectangle(bounds, 0, BLANK, GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));        // Draw background
-
-    // Save size of the scrollbar slider
-    const int slider = GuiGetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE);
+    GuiDrawRectangle(bounds, 0, BLANK, GuiGetStyleColor(DEFAULT, BACKGROUND_COLOR));        // Draw background
 
     // Draw horizontal scrollbar if visible
     if (hasHorizontalScrollBar)
     {
         // Change scrollbar slider size to show the diff in size between the content width and the widget width
-        GuiSetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE, (int)(((bounds.width - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - verticalScrollBarWidth)/(int)content.width)*((int)bounds.width - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - verticalScrollBarWidth)));
+        GuiPushStyle(SCROLLBAR, SCROLL_SLIDER_SIZE, (int)(((bounds.width - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - verticalScrollBarWidth)/(int)content.width)*((int)bounds.width - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - verticalScrollBarWidth)));
         scrollPos.x = (float)-GuiScrollBar(horizontalScrollBar, (int)-scrollPos.x, (int)horizontalMin, (int)horizontalMax);
+        GuiPopStyle();
     }
     else scrollPos.x = 0.0f;
 
@@ -1910,8 +2555,9 @@ int GuiScrollPanel(Rectangle bounds, const char *text, Rectangle content, Vector
     if (hasVerticalScrollBar)
     {
         // Change scrollbar slider size to show the diff in size between the content height and the widget height
-        GuiSetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE, (int)(((bounds.height - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - horizontalScrollBarWidth)/(int)content.height)*((int)bounds.height - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - horizontalScrollBarWidth)));
+        GuiPushStyle(SCROLLBAR, SCROLL_SLIDER_SIZE, (int)(((bounds.height - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - horizontalScrollBarWidth)/(int)content.height)*((int)bounds.height - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - horizontalScrollBarWidth)));
         scrollPos.y = (float)-GuiScrollBar(verticalScrollBar, (int)-scrollPos.y, (int)verticalMin, (int)verticalMax);
+        GuiPopStyle();
     }
     else scrollPos.y = 0.0f;
 
@@ -1919,14 +2565,11 @@ int GuiScrollPanel(Rectangle bounds, const char *text, Rectangle content, Vector
     if (hasHorizontalScrollBar && hasVerticalScrollBar)
     {
         Rectangle corner = { (GuiGetStyle(LISTVIEW, SCROLLBAR_SIDE) == SCROLLBAR_LEFT_SIDE)? (bounds.x + GuiGetStyle(DEFAULT, BORDER_WIDTH) + 2) : (horizontalScrollBar.x + horizontalScrollBar.width + 2), verticalScrollBar.y + verticalScrollBar.height + 2, (float)horizontalScrollBarWidth - 4, (float)verticalScrollBarWidth - 4 };
-        GuiDrawRectangle(corner, 0, BLANK, GetColor(GuiGetStyle(LISTVIEW, TEXT + (state*3))));
+        GuiDrawRectangle(corner, 0, BLANK, GuiGetStyleColor(LISTVIEW, TEXT + (state*3)));
     }
 
     // Draw scrollbar lines depending on current state
-    GuiDrawRectangle(bounds, GuiGetStyle(LISTVIEW, BORDER_WIDTH), GetColor(GuiGetStyle(LISTVIEW, BORDER + (state*3))), BLANK);
-
-    // Set scrollbar slider size back to the way it was before
-    GuiSetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE, slider);
+    GuiDrawRectangle(bounds, GuiGetStyle(LISTVIEW, BORDER_WIDTH), GuiGetStyleColor(LISTVIEW, BORDER + (state*3)), BLANK);
     //--------------------------------------------------------------------
 
     if (scroll != NULL) *scroll = scrollPos;
@@ -1947,7 +2590,7 @@ int GuiLabel(Rectangle bounds, const char *text)
 
     // Draw control
     //--------------------------------------------------------------------
-    GuiDrawText(text, GetTextBounds(LABEL, bounds), GuiGetStyle(LABEL, TEXT_ALIGNMENT), GetColor(GuiGetStyle(LABEL, TEXT + (state*3))));
+    GuiDrawText(text, GetTextBounds(LABEL, bounds), GuiGetStyle(LABEL, TEXT_ALIGNMENT), GuiGetStyleColor(LABEL, TEXT + (state*3)));
     //--------------------------------------------------------------------
 
     return result;
@@ -1978,8 +2621,8 @@ int GuiButton(Rectangle bounds, const char *text)
 
     // Draw control
     //--------------------------------------------------------------------
-    GuiDrawRectangle(bounds, GuiGetStyle(BUTTON, BORDER_WIDTH), GetColor(GuiGetStyle(BUTTON, BORDER + (state*3))), GetColor(GuiGetStyle(BUTTON, BASE + (state*3))));
-    GuiDrawText(text, GetTextBounds(BUTTON, bounds), GuiGetStyle(BUTTON, TEXT_ALIGNMENT), GetColor(GuiGetStyle(BUTTON, TEXT + (state*3))));
+    GuiDrawRectangle(bounds, GuiGetStyle(BUTTON, BORDER_WIDTH), GuiGetStyleColor(BUTTON, BORDER + (state*3)), GuiGetStyleColor(BUTTON, BASE + (state*3)));
+    GuiDrawText(text, GetTextBounds(BUTTON, bounds), GuiGetStyle(BUTTON, TEXT_ALIGNMENT), GuiGetStyleColor(BUTTON, TEXT + (state*3)));
 
     if (state == STATE_FOCUSED) GuiTooltip(bounds);
     //------------------------------------------------------------------
@@ -2016,7 +2659,7 @@ int GuiLabelButton(Rectangle bounds, const char *text)
 
     // Draw control
     //--------------------------------------------------------------------
-    GuiDrawText(text, GetTextBounds(LABEL, bounds), GuiGetStyle(LABEL, TEXT_ALIGNMENT), GetColor(GuiGetStyle(LABEL, TEXT + (state*3))));
+    GuiDrawText(text, GetTextBounds(LABEL, bounds), GuiGetStyle(LABEL, TEXT_ALIGNMENT), GuiGetStyleColor(LABEL, TEXT + (state*3)));
     //--------------------------------------------------------------------
 
     return pressed;
@@ -2055,13 +2698,13 @@ int GuiToggle(Rectangle bounds, const char *text, bool *active)
     //--------------------------------------------------------------------
     if (state == STATE_NORMAL)
     {
-        GuiDrawRectangle(bounds, GuiGetStyle(TOGGLE, BORDER_WIDTH), GetColor(GuiGetStyle(TOGGLE, ((*active)? BORDER_COLOR_PRESSED : (BORDER + state*3)))), GetColor(GuiGetStyle(TOGGLE, ((*active)? BASE_COLOR_PRESSED : (BASE + state*3)))));
-        GuiDrawText(text, GetTextBounds(TOGGLE, bounds), GuiGetStyle(TOGGLE, TEXT_ALIGNMENT), GetColor(GuiGetStyle(TOGGLE, ((*active)? TEXT_COLOR_PRESSED : (TEXT + state*3)))));
+        GuiDrawRectangle(bounds, GuiGetStyle(TOGGLE, BORDER_WIDTH), GuiGetStyleColor(TOGGLE, ((*active)? BORDER_COLOR_PRESSED : (BORDER + state*3))), GuiGetStyleColor(TOGGLE, ((*active)? BASE_COLOR_PRESSED : (BASE + state*3))));
+        GuiDrawText(text, GetTextBounds(TOGGLE, bounds), GuiGetStyle(TOGGLE, TEXT_ALIGNMENT), GuiGetStyleColor(TOGGLE, ((*active)? TEXT_COLOR_PRESSED : (TEXT + state*3))));
     }
     else
     {
-        GuiDrawRectangle(bounds, GuiGetStyle(TOGGLE, BORDER_WIDTH), GetColor(GuiGetStyle(TOGGLE, BORDER + state*3)), GetColor(GuiGetStyle(TOGGLE, BASE + state*3)));
-        GuiDrawText(text, GetTextBounds(TOGGLE, bounds), GuiGetStyle(TOGGLE, TEXT_ALIGNMENT), GetColor(GuiGetStyle(TOGGLE, TEXT + state*3)));
+        GuiDrawRectangle(bounds, GuiGetStyle(TOGGLE, BORDER_WIDTH), GuiGetStyleColor(TOGGLE, BORDER + state*3), GuiGetStyleColor(TOGGLE, BASE + state*3));
+        GuiDrawText(text, GetTextBounds(TOGGLE, bounds), GuiGetStyle(TOGGLE, TEXT_ALIGNMENT), GuiGetStyleColor(TOGGLE, TEXT + state*3));
     }
 
     if (state == STATE_FOCUSED) GuiTooltip(bounds);
@@ -2167,13 +2810,13 @@ int GuiToggleSlider(Rectangle bounds, const char *text, int *active)
 
     // Draw control
     //--------------------------------------------------------------------
-    GuiDrawRectangle(bounds, GuiGetStyle(SLIDER, BORDER_WIDTH), GetColor(GuiGetStyle(TOGGLE, BORDER + (state*3))),
-        GetColor(GuiGetStyle(TOGGLE, BASE_COLOR_NORMAL)));
+    GuiDrawRectangle(bounds, GuiGetStyle(SLIDER, BORDER_WIDTH), GuiGetStyleColor(TOGGLE, BORDER + (state*3)),
+        GuiGetStyleColor(TOGGLE, BASE_COLOR_NORMAL));
 
     // Draw internal slider
-    if (state == STATE_NORMAL) GuiDrawRectangle(slider, 0, BLANK, GetColor(GuiGetStyle(SLIDER, BASE_COLOR_PRESSED)));
-    else if (state == STATE_FOCUSED) GuiDrawRectangle(slider, 0, BLANK, GetColor(GuiGetStyle(SLIDER, BASE_COLOR_FOCUSED)));
-    else if (state == STATE_PRESSED) GuiDrawRectangle(slider, 0, BLANK, GetColor(GuiGetStyle(SLIDER, BASE_COLOR_PRESSED)));
+    if (state == STATE_NORMAL) GuiDrawRectangle(slider, 0, BLANK, GuiGetStyleColor(SLIDER, BASE_COLOR_PRESSED));
+    else if (state == STATE_FOCUSED) GuiDrawRectangle(slider, 0, BLANK, GuiGetStyleColor(SLIDER, BASE_COLOR_FOCUSED));
+    else if (state == STATE_PRESSED) GuiDrawRectangle(slider, 0, BLANK, GuiGetStyleColor(SLIDER, BASE_COLOR_PRESSED));
 
     // Draw text in slider
     if (text != NULL)
@@ -2184,7 +2827,7 @@ int GuiToggleSlider(Rectangle bounds, const char *text, int *active)
         textBounds.x = slider.x + slider.width/2 - textBounds.width/2;
         textBounds.y = bounds.y + bounds.height/2 - GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
 
-        GuiDrawText(items[*active], textBounds, GuiGetStyle(TOGGLE, TEXT_ALIGNMENT), Fade(GetColor(GuiGetStyle(TOGGLE, TEXT + (state*3))), guiAlpha));
+        GuiDrawText(items[*active], textBounds, GuiGetStyle(TOGGLE, TEXT_ALIGNMENT), GuiGetStyleColor(TOGGLE, TEXT + (state*3)));
     }
     //--------------------------------------------------------------------
 
@@ -2241,7 +2884,7 @@ int GuiCheckBox(Rectangle bounds, const char *text, bool *checked)
 
     // Draw control
     //--------------------------------------------------------------------
-    GuiDrawRectangle(bounds, GuiGetStyle(CHECKBOX, BORDER_WIDTH), GetColor(GuiGetStyle(CHECKBOX, BORDER + (state*3))), BLANK);
+    GuiDrawRectangle(bounds, GuiGetStyle(CHECKBOX, BORDER_WIDTH), GuiGetStyleColor(CHECKBOX, BORDER + (state*3)), BLANK);
 
     if (*checked)
     {
@@ -2249,10 +2892,10 @@ int GuiCheckBox(Rectangle bounds, const char *text, bool *checked)
                             bounds.y + GuiGetStyle(CHECKBOX, BORDER_WIDTH) + GuiGetStyle(CHECKBOX, CHECK_PADDING),
                             bounds.width - 2*(GuiGetStyle(CHECKBOX, BORDER_WIDTH) + GuiGetStyle(CHECKBOX, CHECK_PADDING)),
                             bounds.height - 2*(GuiGetStyle(CHECKBOX, BORDER_WIDTH) + GuiGetStyle(CHECKBOX, CHECK_PADDING)) };
-        GuiDrawRectangle(check, 0, BLANK, GetColor(GuiGetStyle(CHECKBOX, TEXT + state*3)));
+        GuiDrawRectangle(check, 0, BLANK, GuiGetStyleColor(CHECKBOX, TEXT + state*3));
     }
 
-    GuiDrawText(text, textBounds, (GuiGetStyle(CHECKBOX, TEXT_ALIGNMENT) == TEXT_ALIGN_RIGHT)? TEXT_ALIGN_LEFT : TEXT_ALIGN_RIGHT, GetColor(GuiGetStyle(LABEL, TEXT + (state*3))));
+    GuiDrawText(text, textBounds, (GuiGetStyle(CHECKBOX, TEXT_ALIGNMENT) == TEXT_ALIGN_RIGHT)? TEXT_ALIGN_LEFT : TEXT_ALIGN_RIGHT, GuiGetStyleColor(LABEL, TEXT + (state*3)));
     //--------------------------------------------------------------------
 
     return result;
@@ -2303,20 +2946,18 @@ int GuiComboBox(Rectangle bounds, const char *text, int *active)
     // Draw control
     //--------------------------------------------------------------------
     // Draw combo box main
-    GuiDrawRectangle(bounds, GuiGetStyle(COMBOBOX, BORDER_WIDTH), GetColor(GuiGetStyle(COMBOBOX, BORDER + (state*3))), GetColor(GuiGetStyle(COMBOBOX, BASE + (state*3))));
-    GuiDrawText(items[*active], GetTextBounds(COMBOBOX, bounds), GuiGetStyle(COMBOBOX, TEXT_ALIGNMENT), GetColor(GuiGetStyle(COMBOBOX, TEXT + (state*3))));
+    GuiDrawRectangle(bounds, GuiGetStyle(COMBOBOX, BORDER_WIDTH), GuiGetStyleColor(COMBOBOX, BORDER + (state*3)), GuiGetStyleColor(COMBOBOX, BASE + (state*3)));
+    GuiDrawText(items[*active], GetTextBounds(COMBOBOX, bounds), GuiGetStyle(COMBOBOX, TEXT_ALIGNMENT), GuiGetStyleColor(COMBOBOX, TEXT + (state*3)));
 
     // Draw selector using a custom button
     // NOTE: BORDER_WIDTH and TEXT_ALIGNMENT forced values
-    int tempBorderWidth = GuiGetStyle(BUTTON, BORDER_WIDTH);
-    int tempTextAlign = GuiGetStyle(BUTTON, TEXT_ALIGNMENT);
-    GuiSetStyle(BUTTON, BORDER_WIDTH, 1);
-    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
+    GuiPushStyle(BUTTON, BORDER_WIDTH, 1);
+    GuiPushStyle(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
 
     GuiButton(selector, TextFormat("%i/%i", *active + 1, itemCount));
 
-    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, tempTextAlign);
-    GuiSetStyle(BUTTON, BORDER_WIDTH, tempBorderWidth);
+    GuiPopStyle();
+    GuiPopStyle();
     //--------------------------------------------------------------------
 
     return result;
@@ -2399,8 +3040,8 @@ int GuiDropdownBox(Rectangle bounds, const char *text, int *active, bool editMod
     //--------------------------------------------------------------------
     if (editMode) GuiPanel(boundsOpen, NULL);
 
-    GuiDrawRectangle(bounds, GuiGetStyle(DROPDOWNBOX, BORDER_WIDTH), GetColor(GuiGetStyle(DROPDOWNBOX, BORDER + state*3)), GetColor(GuiGetStyle(DROPDOWNBOX, BASE + state*3)));
-    GuiDrawText(items[itemSelected], GetTextBounds(DROPDOWNBOX, bounds), GuiGetStyle(DROPDOWNBOX, TEXT_ALIGNMENT), GetColor(GuiGetStyle(DROPDOWNBOX, TEXT + state*3)));
+    GuiDrawRectangle(bounds, GuiGetStyle(DROPDOWNBOX, BORDER_WIDTH), GuiGetStyleColor(DROPDOWNBOX, BORDER + state*3), GuiGetStyleColor(DROPDOWNBOX, BASE + state*3));
+    GuiDrawText(items[itemSelected], GetTextBounds(DROPDOWNBOX, bounds), GuiGetStyle(DROPDOWNBOX, TEXT_ALIGNMENT), GuiGetStyleColor(DROPDOWNBOX, TEXT + state*3));
 
     if (editMode)
     {
@@ -2412,25 +3053,25 @@ int GuiDropdownBox(Rectangle bounds, const char *text, int *active, bool editMod
 
             if (i == itemSelected)
             {
-                GuiDrawRectangle(itemBounds, GuiGetStyle(DROPDOWNBOX, BORDER_WIDTH), GetColor(GuiGetStyle(DROPDOWNBOX, BORDER_COLOR_PRESSED)), GetColor(GuiGetStyle(DROPDOWNBOX, BASE_COLOR_PRESSED)));
-                GuiDrawText(items[i], GetTextBounds(DROPDOWNBOX, itemBounds), GuiGetStyle(DROPDOWNBOX, TEXT_ALIGNMENT), GetColor(GuiGetStyle(DROPDOWNBOX, TEXT_COLOR_PRESSED)));
+                GuiDrawRectangle(itemBounds, GuiGetStyle(DROPDOWNBOX, BORDER_WIDTH), GuiGetStyleColor(DROPDOWNBOX, BORDER_COLOR_PRESSED), GuiGetStyleColor(DROPDOWNBOX, BASE_COLOR_PRESSED));
+                GuiDrawText(items[i], GetTextBounds(DROPDOWNBOX, itemBounds), GuiGetStyle(DROPDOWNBOX, TEXT_ALIGNMENT), GuiGetStyleColor(DROPDOWNBOX, TEXT_COLOR_PRESSED));
             }
             else if (i == itemFocused)
             {
-                GuiDrawRectangle(itemBounds, GuiGetStyle(DROPDOWNBOX, BORDER_WIDTH), GetColor(GuiGetStyle(DROPDOWNBOX, BORDER_COLOR_FOCUSED)), GetColor(GuiGetStyle(DROPDOWNBOX, BASE_COLOR_FOCUSED)));
-                GuiDrawText(items[i], GetTextBounds(DROPDOWNBOX, itemBounds), GuiGetStyle(DROPDOWNBOX, TEXT_ALIGNMENT), GetColor(GuiGetStyle(DROPDOWNBOX, TEXT_COLOR_FOCUSED)));
+                GuiDrawRectangle(itemBounds, GuiGetStyle(DROPDOWNBOX, BORDER_WIDTH), GuiGetStyleColor(DROPDOWNBOX, BORDER_COLOR_FOCUSED), GuiGetStyleColor(DROPDOWNBOX, BASE_COLOR_FOCUSED));
+                GuiDrawText(items[i], GetTextBounds(DROPDOWNBOX, itemBounds), GuiGetStyle(DROPDOWNBOX, TEXT_ALIGNMENT), GuiGetStyleColor(DROPDOWNBOX, TEXT_COLOR_FOCUSED));
             }
-            else GuiDrawText(items[i], GetTextBounds(DROPDOWNBOX, itemBounds), GuiGetStyle(DROPDOWNBOX, TEXT_ALIGNMENT), GetColor(GuiGetStyle(DROPDOWNBOX, TEXT_COLOR_NORMAL)));
+            else GuiDrawText(items[i], GetTextBounds(DROPDOWNBOX, itemBounds), GuiGetStyle(DROPDOWNBOX, TEXT_ALIGNMENT), GuiGetStyleColor(DROPDOWNBOX, TEXT_COLOR_NORMAL));
         }
     }
 
     // Draw arrows (using icon if available)
 #if defined(RAYGUI_NO_ICONS)
     GuiDrawText("v", RAYGUI_CLITERAL(Rectangle){ bounds.x + bounds.width - GuiGetStyle(DROPDOWNBOX, ARROW_PADDING), bounds.y + bounds.height/2 - 2, 10, 10 },
-                TEXT_ALIGN_CENTER, GetColor(GuiGetStyle(DROPDOWNBOX, TEXT + (state*3))));
+                TEXT_ALIGN_CENTER, GuiGetStyleColor(DROPDOWNBOX, TEXT + (state*3)));
 #else
     GuiDrawText("#120#", RAYGUI_CLITERAL(Rectangle){ bounds.x + bounds.width - GuiGetStyle(DROPDOWNBOX, ARROW_PADDING), bounds.y + bounds.height/2 - 6, 10, 10 },
-                TEXT_ALIGN_CENTER, GetColor(GuiGetStyle(DROPDOWNBOX, TEXT + (state*3))));   // ICON_ARROW_DOWN_FILL
+                TEXT_ALIGN_CENTER, GuiGetStyleColor(DROPDOWNBOX, TEXT + (state*3)));   // ICON_ARROW_DOWN_FILL
 #endif
     //--------------------------------------------------------------------
 
@@ -2444,13 +3085,6 @@ int GuiDropdownBox(Rectangle bounds, const char *text, int *active, bool editMod
 // NOTE: Returns true on ENTER pressed (useful for data validation)
 int GuiTextBox(Rectangle bounds, char *text, int bufferSize, bool editMode)
 {
-    #if !defined(RAYGUI_TEXTBOX_AUTO_CURSOR_COOLDOWN)
-        #define RAYGUI_TEXTBOX_AUTO_CURSOR_COOLDOWN  40        // Frames to wait for autocursor movement
-    #endif
-    #if !defined(RAYGUI_TEXTBOX_AUTO_CURSOR_DELAY)
-        #define RAYGUI_TEXTBOX_AUTO_CURSOR_DELAY      1        // Frames delay for autocursor movement
-    #endif
-
     int result = 0;
     GuiState state = guiState;
 
@@ -2458,13 +3092,12 @@ int GuiTextBox(Rectangle bounds, char *text, int bufferSize, bool editMode)
     int wrapMode = GuiGetStyle(DEFAULT, TEXT_WRAP_MODE);
 
     Rectangle textBounds = GetTextBounds(TEXTBOX, bounds);
-    int textWidth = GetTextWidth(text) - GetTextWidth(text + textBoxCursorIndex);
     int textIndexOffset = 0;    // Text index offset to start drawing in the box
 
     // Cursor rectangle
-    // NOTE: Position X value should be updated
+    // NOTE: Position X value is updated on edit mode
     Rectangle cursor = {
-        textBounds.x + textWidth + GuiGetStyle(DEFAULT, TEXT_SPACING),
+        textBounds.x + GuiGetStyle(DEFAULT, TEXT_SPACING),
         textBounds.y + textBounds.height/2 - GuiGetStyle(DEFAULT, TEXT_SIZE),
         2,
         (float)GuiGetStyle(DEFAULT, TEXT_SIZE)*2
@@ -2479,14 +3112,9 @@ int GuiTextBox(Rectangle bounds, char *text, int bufferSize, bool editMode)
     mouseCursor.x = -1;
     mouseCursor.width = 1;
 
-    // Auto-cursor movement logic
+    // Auto-cursor movement logic, only updated by text box on edit mode
     // NOTE: Cursor moves automatically when key down after some time
-    if (IsKeyDown(KEY_LEFT) || IsKeyDown(KEY_RIGHT) || IsKeyDown(KEY_UP) || IsKeyDown(KEY_DOWN) || IsKeyDown(KEY_BACKSPACE) || IsKeyDown(KEY_DELETE)) autoCursorCooldownCounter++;
-    else
-    {
-        autoCursorCooldownCounter = 0;      // GLOBAL: Cursor cooldown counter
-        autoCursorDelayCounter = 0;         // GLOBAL: Cursor delay counter
-    }
+    if (editMode) UpdateAutoCursor();
 
     // Blink-cursor frame counter
     //if (!autoCursorMode) blinkCursorFrameCounter++;
@@ -2507,43 +3135,47 @@ int GuiTextBox(Rectangle bounds, char *text, int bufferSize, bool editMode)
         {
             state = STATE_PRESSED;
 
+            int textLength = (int)strlen(text);     // Get current text length
+            if (textBoxCursorIndex > textLength) textBoxCursorIndex = textLength;
+
+            // Update text prefix widths, only measured again if text or text style changed
+            GuiUpdateTextBoxIndex(text, textLength);
+
             // If text does not fit in the textbox and current cursor position is out of bounds,
             // we add an index offset to text for drawing only what requires depending on cursor
-            while (textWidth >= textBounds.width)
+            if (guiTextBoxIndex.widths[textBoxCursorIndex] >= textBounds.width)
             {
-                int nextCodepointSize = 0;
-                GetCodepointNext(text + textIndexOffset, &nextCodepointSize);
-
-                textIndexOffset += nextCodepointSize;
-
-                textWidth = GetTextWidth(text + textIndexOffset) - GetTextWidth(text + textBoxCursorIndex);
+                textIndexOffset = GuiTextBoxIndexSearch(guiTextBoxIndex.widths[textBoxCursorIndex] - textBounds.width, textBoxCursorIndex);
             }
 
-            int textLength = (int)strlen(text);     // Get current text length
-            int codepoint = GetCharPressed();       // Get Unicode codepoint
-            if (multiline && IsKeyPressed(KEY_ENTER)) codepoint = (int)'\n';
-
-            if (textBoxCursorIndex > textLength) textBoxCursorIndex = textLength;
+            // Get all codepoints pressed this frame, encoded as UTF-8
+            char textInput[RAYGUI_TEXTBOX_MAX_INPUT_SIZE] = { 0 };
+            int textInputSize = GetTextInput(textInput, RAYGUI_TEXTBOX_MAX_INPUT_SIZE, multiline);
 
-            // Encode codepoint as UTF-8
-            int codepointSize = 0;
-            const char *charEncoded = CodepointToUTF8(codepoint, &codepointSize);
+            // Add input text at current cursor position, as a single insertion
+            // NOTE: Make sure we do not overflow buffer size, only full codepoints are added
+            while ((textInputSize > 0) && ((textLength + textInputSize) >= bufferSize))
+            {
+                int prevCodepointSize = 0;
+                GetCodepointPrevious(textInput + textInputSize, &prevCodepointSize);
+                textInputSize -= prevCodepointSize;
+            }
 
-            // Add codepoint to text, at current cursor position
-            // NOTE: Make sure we do not overflow buffer size
-            if (((multiline && (codepoint == (int)'\n')) || (codepoint >= 32)) && ((textLength + codepointSize) < bufferSize))
+            if (textInputSize > 0)
             {
                 // Move forward data from cursor position
-                for (int i = (textLength + codepointSize); i > textBoxCursorIndex; i--) text[i] = text[i - codepointSize];
+                memmove(text + textBoxCursorIndex + textInputSize, text + textBoxCursorIndex, textLength - textBoxCursorIndex);
 
-                // Add new codepoint in current cursor position
-                for (int i = 0; i < codepointSize; i++) text[textBoxCursorIndex + i] = charEncoded[i];
+                // Add input text in current cursor position
+                memcpy(text + textBoxCursorIndex, textInput, textInputSize);
 
-                textBoxCursorIndex += codepointSize;
-                textLength += codepointSize;
+                textLength += textInputSize;
 
                 // Make sure text last character is EOL
                 text[textLength] = '\0';
+
+                GuiTextBoxIndexInsert(text, textBoxCursorIndex, textInputSize);
+                textBoxCursorIndex += textInputSize;
             }
 
             // Move cursor to start
@@ -2553,31 +3185,27 @@ int GuiTextBox(Rectangle bounds, char *text, int bufferSize, bool editMode)
             if ((textLength > textBoxCursorIndex) && IsKeyPressed(KEY_END)) textBoxCursorIndex = textLength;
 
             // Delete codepoint from text, after current cursor position
-            if ((textLength > textBoxCursorIndex) && (IsKeyPressed(KEY_DELETE) || (IsKeyDown(KEY_DELETE) && (autoCursorCooldownCounter >= RAYGUI_TEXTBOX_AUTO_CURSOR_COOLDOWN))))
+            for (int k = GetKeyRepeatCount(KEY_DELETE); (k > 0) && (textLength > textBoxCursorIndex); k--)
             {
-                autoCursorDelayCounter++;
+                int nextCodepointSize = 0;
+                GetCodepointNext(text + textBoxCursorIndex, &nextCodepointSize);
 
-                if (IsKeyPressed(KEY_DELETE) || (autoCursorDelayCounter%RAYGUI_TEXTBOX_AUTO_CURSOR_DELAY) == 0)      // Delay every movement some frames
-                {
-                    int nextCodepointSize = 0;
-                    GetCodepointNext(text + textBoxCursorIndex, &nextCodepointSize);
+                // Move backward text from cursor position
+                for (int i = textBoxCursorIndex; i < textLength; i++) text[i] = text[i + nextCodepointSize];
 
-                    // Move backward text from cursor position
-                    for (int i = textBoxCursorIndex; i < textLength; i++) text[i] = text[i + nextCodepointSize];
+                textLength -= nextCodepointSize;
 
-                    textLength -= codepointSize;
+                // Make sure text last character is EOL
+                text[textLength] = '\0';
 
-                    // Make sure text last character is EOL
-                    text[textLength] = '\0';
-                }
+                GuiTextBoxIndexDelete(text, textBoxCursorIndex, nextCodepointSize);
             }
 
             // Delete codepoint from text, before current cursor position
-            if ((textLength > 0) && (IsKeyPressed(KEY_BACKSPACE) || (IsKeyDown(KEY_BACKSPACE) && (autoCursorCooldownCounter >= RAYGUI_TEXTBOX_AUTO_CURSOR_COOLDOWN))))
+            for (int k = GetKeyRepeatCount(KEY_BACKSPACE); (k > 0) && (textLength > 0); k--)
             {
-                autoCursorDelayCounter++;
-
-                if (IsKeyPressed(KEY_BACKSPACE) || (autoCursorDelayCounter%RAYGUI_TEXTBOX_AUTO_CURSOR_DELAY) == 0)      // Delay every movement some frames
+                // Prevent cursor index from decrementing past 0
+                if (textBoxCursorIndex > 0)
                 {
                     int prevCodepointSize = 0;
                     GetCodepointPrevious(text + textBoxCursorIndex, &prevCodepointSize);
@@ -2585,24 +3213,20 @@ int GuiTextBox(Rectangle bounds, char *text, int bufferSize, bool editMode)
                     // Move backward text from cursor position
                     for (int i = (textBoxCursorIndex - prevCodepointSize); i < textLength; i++) text[i] = text[i + prevCodepointSize];
 
-                    // Prevent cursor index from decrementing past 0
-                    if (textBoxCursorIndex > 0)
-                    {
-                        textBoxCursorIndex -= codepointSize;
-                        textLength -= codepointSize;
-                    }
+                    textBoxCursorIndex -= prevCodepointSize;
+                    textLength -= prevCodepointSize;
 
                     // Make sure text last character is EOL
                     text[textLength] = '\0';
+
+                    GuiTextBoxIndexDelete(text, textBoxCursorIndex, prevCodepointSize);
                 }
             }
 
             // Move cursor position with keys
-            if (IsKeyPressed(KEY_LEFT) || (IsKeyDown(KEY_LEFT) && (autoCursorCooldownCounter > RAYGUI_TEXTBOX_AUTO_CURSOR_COOLDOWN)))
+            if (GetKeyRepeatCount(KEY_LEFT) > 0)
             {
-                autoCursorDelayCounter++;
-
-                if (IsKeyPressed(KEY_LEFT) || (autoCursorDelayCounter%RAYGUI_TEXTBOX_AUTO_CURSOR_DELAY) == 0)      // Delay every movement some frames
+                for (int k = GetKeyRepeatCount(KEY_LEFT); k > 0; k--)
                 {
                     int prevCodepointSize = 0;
                     GetCodepointPrevious(text + textBoxCursorIndex, &prevCodepointSize);
@@ -2610,11 +3234,9 @@ int GuiTextBox(Rectangle bounds, char *text, int bufferSize, bool editMode)
                     if (textBoxCursorIndex >= prevCodepointSize) textBoxCursorIndex -= prevCodepointSize;
                 }
             }
-            else if (IsKeyPressed(KEY_RIGHT) || (IsKeyDown(KEY_RIGHT) && (autoCursorCooldownCounter > RAYGUI_TEXTBOX_AUTO_CURSOR_COOLDOWN)))
+            else if (GetKeyRepeatCount(KEY_RIGHT) > 0)
             {
-                autoCursorDelayCounter++;
-
-                if (IsKeyPressed(KEY_RIGHT) || (autoCursorDelayCounter%RAYGUI_TEXTBOX_AUTO_CURSOR_DELAY) == 0)      // Delay every movement some frames
+                for (int k = GetKeyRepeatCount(KEY_RIGHT); k > 0; k--)
                 {
                     int nextCodepointSize = 0;
                     GetCodepointNext(text + textBoxCursorIndex, &nextCodepointSize);
@@ -2626,37 +3248,26 @@ int GuiTextBox(Rectangle bounds, char *text, int bufferSize, bool editMode)
             // Move cursor position with mouse
             if (CheckCollisionPointRec(mousePosition, textBounds))     // Mouse hover text
             {
-                float scaleFactor = (float)GuiGetStyle(DEFAULT, TEXT_SIZE)/(float)guiFont.baseSize;
-                int codepointIndex = 0;
-                float glyphWidth = 0.0f;
-                float widthToMouseX = 0;
-                int mouseCursorIndex = 0;
+                const float *textWidths = guiTextBoxIndex.widths;
+                float widthToMouseX = textWidths[textIndexOffset] + (mousePosition.x - textBounds.x);
 
-                for (int i = textIndexOffset; i < textLength; i++)
-                {
-                    codepoint = GetCodepointNext(&text[i], &codepointSize);
-                    codepointIndex = GetGlyphIndex(guiFont, codepoint);
+                // Get codepoint under mouse, cursor is placed before or after it
+                // depending on the mouse position relative to the glyph center
+                int mouseCursorIndex = GuiTextBoxIndexSearch(widthToMouseX, textLength);
 
-                    if (guiFont.glyphs[codepointIndex].advanceX == 0) glyphWidth = ((float)guiFont.recs[codepointIndex].width*scaleFactor);
-                    else glyphWidth = ((float)guiFont.glyphs[codepointIndex].advanceX*scaleFactor);
+                if (mouseCursorIndex > textIndexOffset)
+                {
+                    int prevCodepointSize = 0;
+                    GetCodepointPrevious(text + mouseCursorIndex, &prevCodepointSize);
 
-                    if (mousePosition.x <= (textBounds.x + (widthToMouseX + glyphWidth/2)))
-                    {
-                        mouseCursor.x = textBounds.x + widthToMouseX;
-                        mouseCursorIndex = i;
-                        break;
-                    }
+                    int prevIndex = mouseCursorIndex - prevCodepointSize;
+                    float glyphWidth = textWidths[mouseCursorIndex] - textWidths[prevIndex] - (float)GuiGetStyle(DEFAULT, TEXT_SPACING);
 
-                    widthToMouseX += (glyphWidth + (float)GuiGetStyle(DEFAULT, TEXT_SPACING));
+                    if (widthToMouseX <= (textWidths[prevIndex] + glyphWidth/2)) mouseCursorIndex = prevIndex;
                 }
+                else mouseCursorIndex = textIndexOffset;
 
-                // Check if mouse cursor is at the last position
-                int textEndWidth = GetTextWidth(text + textIndexOffset);
-                if (GetMousePosition().x >= (textBounds.x + textEndWidth - glyphWidth/2))
-                {
-                    mouseCursor.x = textBounds.x + textEndWidth;
-                    mouseCursorIndex = (int)strlen(text);
-                }
+                mouseCursor.x = textBounds.x + textWidths[mouseCursorIndex] - textWidths[textIndexOffset];
 
                 // Place cursor at required index on mouse click
                 if ((mouseCursor.x >= 0) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
@@ -2667,8 +3278,8 @@ int GuiTextBox(Rectangle bounds, char *text, int bufferSize, bool editMode)
             }
             else mouseCursor.x = -1;
 
-            // Recalculate cursor position.y depending on textBoxCursorIndex
-            cursor.x = bounds.x + GuiGetStyle(TEXTBOX, TEXT_PADDING) + GetTextWidth(text + textIndexOffset) - GetTextWidth(text + textBoxCursorIndex) + GuiGetStyle(DEFAULT, TEXT_SPACING);
+            // Recalculate cursor position.x depending on textBoxCursorIndex
+            cursor.x = bounds.x + GuiGetStyle(TEXTBOX, TEXT_PADDING) + guiTextBoxIndex.widths[textBoxCursorIndex] - guiTextBoxIndex.widths[textIndexOffset] + GuiGetStyle(DEFAULT, TEXT_SPACING);
             //if (multiline) cursor.y = GetTextLines()
 
             // Finish text editing on ENTER or mouse click outside bounds
@@ -2699,26 +3310,26 @@ int GuiTextBox(Rectangle bounds, char *text, int bufferSize, bool editMode)
     //--------------------------------------------------------------------
     if (state == STATE_PRESSED)
     {
-        GuiDrawRectangle(bounds, GuiGetStyle(TEXTBOX, BORDER_WIDTH), GetColor(GuiGetStyle(TEXTBOX, BORDER + (state*3))), GetColor(GuiGetStyle(TEXTBOX, BASE_COLOR_PRESSED)));
+        GuiDrawRectangle(bounds, GuiGetStyle(TEXTBOX, BORDER_WIDTH), GuiGetStyleColor(TEXTBOX, BORDER + (state*3)), GuiGetStyleColor(TEXTBOX, BASE_COLOR_PRESSED));
     }
     else if (state == STATE_DISABLED)
     {
-        GuiDrawRectangle(bounds, GuiGetStyle(TEXTBOX, BORDER_WIDTH), GetColor(GuiGetStyle(TEXTBOX, BORDER + (state*3))), GetColor(GuiGetStyle(TEXTBOX, BASE_COLOR_DISABLED)));
+        GuiDrawRectangle(bounds, GuiGetStyle(TEXTBOX, BORDER_WIDTH), GuiGetStyleColor(TEXTBOX, BORDER + (state*3)), GuiGetStyleColor(TEXTBOX, BASE_COLOR_DISABLED));
     }
-    else GuiDrawRectangle(bounds, GuiGetStyle(TEXTBOX, BORDER_WIDTH), GetColor(GuiGetStyle(TEXTBOX, BORDER + (state*3))), BLANK);
+    else GuiDrawRectangle(bounds, GuiGetStyle(TEXTBOX, BORDER_WIDTH), GuiGetStyleColor(TEXTBOX, BORDER + (state*3)), BLANK);
 
     // Draw text considering index offset if required
     // NOTE: Text index offset depends on cursor position
-    GuiDrawText(text + textIndexOffset, textBounds, GuiGetStyle(TEXTBOX, TEXT_ALIGNMENT), GetColor(GuiGetStyle(TEXTBOX, TEXT + (state*3))));
+    GuiDrawText(text + textIndexOffset, textBounds, GuiGetStyle(TEXTBOX, TEXT_ALIGNMENT), GuiGetStyleColor(TEXTBOX, TEXT + (state*3)));
 
     // Draw cursor
     if (editMode && !GuiGetStyle(TEXTBOX, TEXT_READONLY))
     {
         //if (autoCursorMode || ((blinkCursorFrameCounter/40)%2 == 0))
-        GuiDrawRectangle(cursor, 0, BLANK, GetColor(GuiGetStyle(TEXTBOX, BORDER_COLOR_PRESSED)));
+        GuiDrawRectangle(cursor, 0, BLANK, GuiGetStyleColor(TEXTBOX, BORDER_COLOR_PRESSED));
 
         // Draw mouse position cursor (if required)
-        if (mouseCursor.x >= 0) GuiDrawRectangle(mouseCursor, 0, BLANK, GetColor(GuiGetStyle(TEXTBOX, BORDER_COLOR_PRESSED)));
+        if (mouseCursor.x >= 0) GuiDrawRectangle(mouseCursor, 0, BLANK, GuiGetStyleColor(TEXTBOX, BORDER_COLOR_PRESSED));
     }
     else if (state == STATE_FOCUSED) GuiTooltip(bounds);
     //--------------------------------------------------------------------
@@ -2726,109 +3337,314 @@ int GuiTextBox(Rectangle bounds, char *text, int bufferSize, bool editMode)
     return result;      // Mouse button pressed: result = 1
 }
 
-/*
-// Text Box control with multiple lines and word-wrap
-// NOTE: This text-box is readonly, no editing supported by default
-bool GuiTextBoxMulti(Rectangle bounds, char *text, int bufferSize, bool editMode)
+// Text Box control with text buffer, supports large and multiline text
+// NOTE: Text is edited in place on a gap buffer, cursor is the text buffer gap position,
+// ENTER key inserts a line break, text editing finishes on mouse click outside bounds
+int GuiTextBoxEx(Rectangle bounds, GuiTextBuffer *buffer, bool editMode)
 {
-    bool pressed = false;
-
-    GuiSetStyle(TEXTBOX, TEXT_READONLY, 1);
-    GuiSetStyle(DEFAULT, TEXT_WRAP_MODE, TEXT_WRAP_WORD);   // WARNING: If wrap mode enabled, text editing is not supported
-    GuiSetStyle(DEFAULT, TEXT_ALIGNMENT_VERTICAL, TEXT_ALIGN_TOP);
-
-    // TODO: Implement methods to calculate cursor position properly
-    pressed = GuiTextBox(bounds, text, bufferSize, editMode);
-
-    GuiSetStyle(DEFAULT, TEXT_ALIGNMENT_VERTICAL, TEXT_ALIGN_MIDDLE);
-    GuiSetStyle(DEFAULT, TEXT_WRAP_MODE, TEXT_WRAP_NONE);
-    GuiSetStyle(TEXTBOX, TEXT_READONLY, 0);
+    int result = 0;
+    GuiState state = guiState;
 
-    return pressed;
-}
-*/
+    Rectangle textBounds = GetTextBounds(TEXTBOX, bounds);
+    float fontSize = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
+    float textSpacing = (float)GuiGetStyle(DEFAULT, TEXT_SPACING);
+    int lineSpacing = GuiGetStyle(DEFAULT, TEXT_LINE_SPACING);
+    if (lineSpacing <= 0) lineSpacing = (int)fontSize;
 
-// Spinner control, returns selected value
-int GuiSpinner(Rectangle bounds, const char *text, int *value, int minValue, int maxValue, bool editMode)
-{
-    int result = 1;
-    GuiState state = guiState;
+    int visibleLines = (int)((textBounds.height - fontSize)/lineSpacing) + 1;
+    if (visibleLines < 1) visibleLines = 1;
 
-    int tempValue = *value;
+    if (buffer->firstLine >= buffer->lineCount) buffer->firstLine = buffer->lineCount - 1;
 
-    Rectangle spinner = { bounds.x + GuiGetStyle(SPINNER, SPIN_BUTTON_WIDTH) + GuiGetStyle(SPINNER, SPIN_BUTTON_SPACING), bounds.y,
-                          bounds.width - 2*(GuiGetStyle(SPINNER, SPIN_BUTTON_WIDTH) + GuiGetStyle(SPINNER, SPIN_BUTTON_SPACING)), bounds.height };
-    Rectangle leftButtonBound = { (float)bounds.x, (float)bounds.y, (float)GuiGetStyle(SPINNER, SPIN_BUTTON_WIDTH), (float)bounds.height };
-    Rectangle rightButtonBound = { (float)bounds.x + bounds.width - GuiGetStyle(SPINNER, SPIN_BUTTON_WIDTH), (float)bounds.y, (float)GuiGetStyle(SPINNER, SPIN_BUTTON_WIDTH), (float)bounds.height };
+    // Mouse cursor rectangle
+    // NOTE: Initialized outside of screen
+    Rectangle mouseCursor = { -1, textBounds.y, 1, fontSize };
 
-    Rectangle textBounds = { 0 };
-    if (text != NULL)
-    {
-        textBounds.width = (float)GetTextWidth(text) + 2;
-        textBounds.height = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
-        textBounds.x = bounds.x + bounds.width + GuiGetStyle(SPINNER, TEXT_PADDING);
-        textBounds.y = bounds.y + bounds.height/2 - GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
-        if (GuiGetStyle(SPINNER, TEXT_ALIGNMENT) == TEXT_ALIGN_LEFT) textBounds.x = bounds.x - textBounds.width - GuiGetStyle(SPINNER, TEXT_PADDING);
-    }
+    // Auto-cursor movement logic, only updated by text box on edit mode
+    // NOTE: Cursor moves automatically when key down after some time
+    if (editMode) UpdateAutoCursor();
 
     // Update control
     //--------------------------------------------------------------------
-    if ((state != STATE_DISABLED) && !guiLocked && !guiSliderDragging)
+    if ((state != STATE_DISABLED) && !GuiGetStyle(TEXTBOX, TEXT_READONLY) && !guiLocked && !guiSliderDragging)
     {
-        Vector2 mousePoint = GetMousePosition();
+        Vector2 mousePosition = GetMousePosition();
 
-        // Check spinner state
-        if (CheckCollisionPointRec(mousePoint, bounds))
+        if (editMode)
         {
-            if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) state = STATE_PRESSED;
-            else state = STATE_FOCUSED;
-        }
-    }
+            state = STATE_PRESSED;
 
-#if defined(RAYGUI_NO_ICONS)
-    if (GuiButton(leftButtonBound, "<")) tempValue--;
-    if (GuiButton(rightButtonBound, ">")) tempValue++;
-#else
-    if (GuiButton(leftButtonBound, GuiIconText(ICON_ARROW_LEFT_FILL, NULL))) tempValue--;
-    if (GuiButton(rightButtonBound, GuiIconText(ICON_ARROW_RIGHT_FILL, NULL))) tempValue++;
-#endif
+            // Add all codepoints pressed this frame at current cursor position, as a single insertion
+            char textInput[RAYGUI_TEXTBOX_MAX_INPUT_SIZE] = { 0 };
+            int textInputSize = GetTextInput(textInput, RAYGUI_TEXTBOX_MAX_INPUT_SIZE, true);
 
-    if (!editMode)
-    {
-        if (tempValue < minValue) tempValue = minValue;
-        if (tempValue > maxValue) tempValue = maxValue;
-    }
-    //--------------------------------------------------------------------
+            if (textInputSize > 0) GuiTextBufferInsert(buffer, textInput, textInputSize);
 
-    // Draw control
-    //--------------------------------------------------------------------
-    result = GuiValueBox(spinner, NULL, &tempValue, minValue, maxValue, editMode);
+            // Move cursor to line start/end
+            if (IsKeyPressed(KEY_HOME)) GuiTextBufferMoveGap(buffer, buffer->lineStarts[GuiTextBufferGetLine(buffer, buffer->gapStart)]);
+            if (IsKeyPressed(KEY_END)) GuiTextBufferMoveGap(buffer, GuiTextBufferGetLineEnd(buffer, GuiTextBufferGetLine(buffer, buffer->gapStart)));
 
-    // Draw value selector custom buttons
-    // NOTE: BORDER_WIDTH and TEXT_ALIGNMENT forced values
-    int tempBorderWidth = GuiGetStyle(BUTTON, BORDER_WIDTH);
-    int tempTextAlign = GuiGetStyle(BUTTON, TEXT_ALIGNMENT);
-    GuiSetStyle(BUTTON, BORDER_WIDTH, GuiGetStyle(SPINNER, BORDER_WIDTH));
-    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
+            // Delete codepoint from text, after current cursor position
+            for (int k = GetKeyRepeatCount(KEY_DELETE); (k > 0) && (buffer->gapStart < buffer->length); k--)
+            {
+                int nextCodepointSize = 0;
+                GuiTextBufferCodepoint(buffer, buffer->gapStart, &nextCodepointSize);
 
-    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, tempTextAlign);
-    GuiSetStyle(BUTTON, BORDER_WIDTH, tempBorderWidth);
+                GuiTextBufferDelete(buffer, buffer->gapStart, nextCodepointSize);
+            }
 
-    // Draw text label if provided
-    GuiDrawText(text, textBounds, (GuiGetStyle(SPINNER, TEXT_ALIGNMENT) == TEXT_ALIGN_RIGHT)? TEXT_ALIGN_LEFT : TEXT_ALIGN_RIGHT, GetColor(GuiGetStyle(LABEL, TEXT + (state*3))));
-    //--------------------------------------------------------------------
+            // Delete codepoint from text, before current cursor position
+            for (int k = GetKeyRepeatCount(KEY_BACKSPACE); (k > 0) && (buffer->gapStart > 0); k--)
+            {
+                int prevPosition = GuiTextBufferPrevious(buffer, buffer->gapStart);
 
-    *value = tempValue;
-    return result;
-}
+                GuiTextBufferDelete(buffer, prevPosition, buffer->gapStart - prevPosition);
+            }
 
-// Value Box control, updates input text with numbers
-// NOTE: Requires static variables: frameCounter
-int GuiValueBox(Rectangle bounds, const char *text, int *value, int minValue, int maxValue, bool editMode)
-{
-    #if !defined(RAYGUI_VALUEBOX_MAX_CHARS)
-        #define RAYGUI_VALUEBOX_MAX_CHARS  32
-    #endif
+            // Move cursor position with keys
+            if (GetKeyRepeatCount(KEY_LEFT) > 0)
+            {
+                for (int k = GetKeyRepeatCount(KEY_LEFT); k > 0; k--)
+                {
+                    if (buffer->gapStart > 0) GuiTextBufferMoveGap(buffer, GuiTextBufferPrevious(buffer, buffer->gapStart));
+                }
+            }
+            else if (GetKeyRepeatCount(KEY_RIGHT) > 0)
+            {
+                for (int k = GetKeyRepeatCount(KEY_RIGHT); k > 0; k--)
+                {
+                    int nextCodepointSize = 0;
+                    GuiTextBufferCodepoint(buffer, buffer->gapStart, &nextCodepointSize);
+
+                    if (buffer->gapStart < buffer->length) GuiTextBufferMoveGap(buffer, buffer->gapStart + nextCodepointSize);
+                }
+            }
+            else if (GetKeyRepeatCount(KEY_UP) > 0)
+            {
+                for (int k = GetKeyRepeatCount(KEY_UP); k > 0; k--)
+                {
+                    // Move cursor to previous line, keeping cursor horizontal position
+                    int line = GuiTextBufferGetLine(buffer, buffer->gapStart);
+                    float width = GuiTextBufferGetWidth(buffer, buffer->lineStarts[line], buffer->gapStart);
+
+                    if (line > 0) GuiTextBufferMoveGap(buffer, GuiTextBufferGetPosition(buffer, line - 1, width));
+                }
+            }
+            else if (GetKeyRepeatCount(KEY_DOWN) > 0)
+            {
+                for (int k = GetKeyRepeatCount(KEY_DOWN); k > 0; k--)
+                {
+                    // Move cursor to next line, keeping cursor horizontal position
+                    int line = GuiTextBufferGetLine(buffer, buffer->gapStart);
+                    float width = GuiTextBufferGetWidth(buffer, buffer->lineStarts[line], buffer->gapStart);
+
+                    if (line < (buffer->lineCount - 1)) GuiTextBufferMoveGap(buffer, GuiTextBufferGetPosition(buffer, line + 1, width));
+                }
+            }
+
+            // Move cursor position with mouse
+            if (CheckCollisionPointRec(mousePosition, textBounds))     // Mouse hover text
+            {
+                int mouseLine = buffer->firstLine + (int)((mousePosition.y - textBounds.y)/lineSpacing);
+                if (mouseLine >= buffer->lineCount) mouseLine = buffer->lineCount - 1;
+
+                int mouseCursorIndex = GuiTextBufferGetPosition(buffer, mouseLine, mousePosition.x - textBounds.x + buffer->offsetX);
+
+                mouseCursor.x = textBounds.x + GuiTextBufferGetWidth(buffer, buffer->lineStarts[mouseLine], mouseCursorIndex) - buffer->offsetX;
+                mouseCursor.y = textBounds.y + (mouseLine - buffer->firstLine)*lineSpacing;
+
+                // Place cursor at required index on mouse click
+                if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) GuiTextBufferMoveGap(buffer, mouseCursorIndex);
+            }
+
+            // Finish text editing on mouse click outside bounds
+            if (!CheckCollisionPointRec(mousePosition, bounds) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) result = 1;
+        }
+        else
+        {
+            if (CheckCollisionPointRec(mousePosition, bounds))
+            {
+                state = STATE_FOCUSED;
+
+                if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) result = 1;
+            }
+        }
+    }
+
+    // Get cursor line and position, scrolling text to keep cursor visible on edit mode
+    int cursorLine = GuiTextBufferGetLine(buffer, buffer->gapStart);
+    float cursorOffsetX = GuiTextBufferGetWidth(buffer, buffer->lineStarts[cursorLine], buffer->gapStart);
+
+    if (state == STATE_PRESSED)
+    {
+        if (cursorLine < buffer->firstLine) buffer->firstLine = cursorLine;
+        else if (cursorLine >= (buffer->firstLine + visibleLines)) buffer->firstLine = cursorLine - visibleLines + 1;
+
+        if (cursorOffsetX < buffer->offsetX) buffer->offsetX = cursorOffsetX;
+        else if ((cursorOffsetX + textSpacing + 2) > (buffer->offsetX + textBounds.width)) buffer->offsetX = cursorOffsetX + textSpacing + 2 - textBounds.width;
+    }
+
+    // Cursor rectangle
+    Rectangle cursor = {
+        textBounds.x + cursorOffsetX - buffer->offsetX + textSpacing,
+        textBounds.y + (cursorLine - buffer->firstLine)*lineSpacing,
+        2,
+        fontSize
+    };
+    //--------------------------------------------------------------------
+
+    // Draw control
+    //--------------------------------------------------------------------
+    if (state == STATE_PRESSED)
+    {
+        GuiDrawRectangle(bounds, GuiGetStyle(TEXTBOX, BORDER_WIDTH), GuiGetStyleColor(TEXTBOX, BORDER + (state*3)), GuiGetStyleColor(TEXTBOX, BASE_COLOR_PRESSED));
+    }
+    else if (state == STATE_DISABLED)
+    {
+        GuiDrawRectangle(bounds, GuiGetStyle(TEXTBOX, BORDER_WIDTH), GuiGetStyleColor(TEXTBOX, BORDER + (state*3)), GuiGetStyleColor(TEXTBOX, BASE_COLOR_DISABLED));
+    }
+    else GuiDrawRectangle(bounds, GuiGetStyle(TEXTBOX, BORDER_WIDTH), GuiGetStyleColor(TEXTBOX, BORDER + (state*3)), BLANK);
+
+    // Draw visible text lines, only glyphs inside text bounds are drawn
+    // NOTE: Text is read directly from text buffer data, no text copy required
+    const float *glyphAdvances = GuiGetGlyphAdvances();
+    Color textColor = GuiGetStyleColor(TEXTBOX, TEXT + (state*3));
+    Vector2 textPosition = { (float)((int)textBounds.x), (float)((int)textBounds.y) };
+
+    for (int line = buffer->firstLine; (line < buffer->lineCount) && (line < (buffer->firstLine + visibleLines)); line++)
+    {
+        int lineEnd = GuiTextBufferGetLineEnd(buffer, line);
+        float textOffsetX = -buffer->offsetX;
+
+        for (int i = buffer->lineStarts[line], codepointSize = 0; (i < lineEnd) && (textOffsetX < textBounds.width); i += codepointSize)
+        {
+            int codepoint = GuiTextBufferCodepoint(buffer, i, &codepointSize);
+            int index = GuiGetGlyphIndex(codepoint);
+
+            if ((codepoint != ' ') && (codepoint != '\t') && (textOffsetX >= 0.0f) && (textOffsetX <= (textBounds.width - glyphAdvances[index])))
+            {
+                GuiDrawGlyph(index, RAYGUI_CLITERAL(Vector2){ textPosition.x + textOffsetX, textPosition.y + (line - buffer->firstLine)*lineSpacing }, fontSize, textColor);
+            }
+
+            textOffsetX += (glyphAdvances[index] + textSpacing);
+        }
+    }
+
+    // Draw cursor
+    if (editMode && !GuiGetStyle(TEXTBOX, TEXT_READONLY))
+    {
+        GuiDrawRectangle(cursor, 0, BLANK, GuiGetStyleColor(TEXTBOX, BORDER_COLOR_PRESSED));
+
+        // Draw mouse position cursor (if required)
+        if (mouseCursor.x >= 0) GuiDrawRectangle(mouseCursor, 0, BLANK, GuiGetStyleColor(TEXTBOX, BORDER_COLOR_PRESSED));
+    }
+    else if (state == STATE_FOCUSED) GuiTooltip(bounds);
+    //--------------------------------------------------------------------
+
+    return result;      // Mouse button pressed: result = 1
+}
+
+/*
+// Text Box control with multiple lines and word-wrap
+// NOTE: This text-box is readonly, no editing supported by default
+bool GuiTextBoxMulti(Rectangle bounds, char *text, int bufferSize, bool editMode)
+{
+    bool pressed = false;
+
+    GuiPushStyle(TEXTBOX, TEXT_READONLY, 1);
+    GuiPushStyle(DEFAULT, TEXT_WRAP_MODE, TEXT_WRAP_WORD);   // WARNING: If wrap mode enabled, text editing is not supported
+    GuiPushStyle(DEFAULT, TEXT_ALIGNMENT_VERTICAL, TEXT_ALIGN_TOP);
+
+    // TODO: Implement methods to calculate cursor position properly
+    pressed = GuiTextBox(bounds, text, bufferSize, editMode);
+
+    GuiPopStyle();
+    GuiPopStyle();
+    GuiPopStyle();
+
+    return pressed;
+}
+*/
+
+// Spinner control, returns selected value
+int GuiSpinner(Rectangle bounds, const char *text, int *value, int minValue, int maxValue, bool editMode)
+{
+    int result = 1;
+    GuiState state = guiState;
+
+    int tempValue = *value;
+
+    Rectangle spinner = { bounds.x + GuiGetStyle(SPINNER, SPIN_BUTTON_WIDTH) + GuiGetStyle(SPINNER, SPIN_BUTTON_SPACING), bounds.y,
+                          bounds.width - 2*(GuiGetStyle(SPINNER, SPIN_BUTTON_WIDTH) + GuiGetStyle(SPINNER, SPIN_BUTTON_SPACING)), bounds.height };
+    Rectangle leftButtonBound = { (float)bounds.x, (float)bounds.y, (float)GuiGetStyle(SPINNER, SPIN_BUTTON_WIDTH), (float)bounds.height };
+    Rectangle rightButtonBound = { (float)bounds.x + bounds.width - GuiGetStyle(SPINNER, SPIN_BUTTON_WIDTH), (float)bounds.y, (float)GuiGetStyle(SPINNER, SPIN_BUTTON_WIDTH), (float)bounds.height };
+
+    Rectangle textBounds = { 0 };
+    if (text != NULL)
+    {
+        textBounds.width = (float)GetTextWidth(text) + 2;
+        textBounds.height = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
+        textBounds.x = bounds.x + bounds.width + GuiGetStyle(SPINNER, TEXT_PADDING);
+        textBounds.y = bounds.y + bounds.height/2 - GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
+        if (GuiGetStyle(SPINNER, TEXT_ALIGNMENT) == TEXT_ALIGN_LEFT) textBounds.x = bounds.x - textBounds.width - GuiGetStyle(SPINNER, TEXT_PADDING);
+    }
+
+    // Update control
+    //--------------------------------------------------------------------
+    if ((state != STATE_DISABLED) && !guiLocked && !guiSliderDragging)
+    {
+        Vector2 mousePoint = GetMousePosition();
+
+        // Check spinner state
+        if (CheckCollisionPointRec(mousePoint, bounds))
+        {
+            if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) state = STATE_PRESSED;
+            else state = STATE_FOCUSED;
+        }
+    }
+
+#if defined(RAYGUI_NO_ICONS)
+    if (GuiButton(leftButtonBound, "<")) tempValue--;
+    if (GuiButton(rightButtonBound, ">")) tempValue++;
+#else
+    if (GuiButton(leftButtonBound, GuiIconText(ICON_ARROW_LEFT_FILL, NULL))) tempValue--;
+    if (GuiButton(rightButtonBound, GuiIconText(ICON_ARROW_RIGHT_FILL, NULL))) tempValue++;
+#endif
+
+    if (!editMode)
+    {
+        if (tempValue < minValue) tempValue = minValue;
+        if (tempValue > maxValue) tempValue = maxValue;
+    }
+    //--------------------------------------------------------------------
+
+    // Draw control
+    //--------------------------------------------------------------------
+    result = GuiValueBox(spinner, NULL, &tempValue, minValue, maxValue, editMode);
+
+    // Draw value selector custom buttons
+    // NOTE: BORDER_WIDTH and TEXT_ALIGNMENT forced values
+    GuiPushStyle(BUTTON, BORDER_WIDTH, GuiGetStyle(SPINNER, BORDER_WIDTH));
+    GuiPushStyle(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
+
+    GuiPopStyle();
+    GuiPopStyle();
+
+    // Draw text label if provided
+    GuiDrawText(text, textBounds, (GuiGetStyle(SPINNER, TEXT_ALIGNMENT) == TEXT_ALIGN_RIGHT)? TEXT_ALIGN_LEFT : TEXT_ALIGN_RIGHT, GuiGetStyleColor(LABEL, TEXT + (state*3)));
+    //--------------------------------------------------------------------
+
+    *value = tempValue;
+    return result;
+}
+
+// Value Box control, updates input text with numbers
+// NOTE: Requires static variables: frameCounter
+int GuiValueBox(Rectangle bounds, const char *text, int *value, int minValue, int maxValue, bool editMode)
+{
+    #if !defined(RAYGUI_VALUEBOX_MAX_CHARS)
+        #define RAYGUI_VALUEBOX_MAX_CHARS  32
+    #endif
 
     int result = 0;
     GuiState state = guiState;
@@ -2860,18 +3676,20 @@ int GuiValueBox(Rectangle bounds, const char *text, int *value, int minValue, in
 
             int keyCount = (int)strlen(textValue);
 
-            // Only allow keys in range [48..57]
-            if (keyCount < RAYGUI_VALUEBOX_MAX_CHARS)
+            // Process all keys pressed this frame, only allow keys in range [48..57]
+            // NOTE: Text width is measured once and updated with every key added
+            const float *glyphAdvances = GuiGetGlyphAdvances();
+            float textWidth = (float)GetTextWidth(textValue);
+
+            for (int key = GetCharPressed(); key > 0; key = GetCharPressed())
             {
-                if (GetTextWidth(textValue) < bounds.width)
+                if ((key >= 48) && (key <= 57) && (keyCount < RAYGUI_VALUEBOX_MAX_CHARS) && (textWidth < bounds.width))
                 {
-                    int key = GetCharPressed();
-                    if ((key >= 48) && (key <= 57))
-                    {
-                        textValue[keyCount] = (char)key;
-                        keyCount++;
-                        valueHasChanged = true;
-                    }
+                    textValue[keyCount] = (char)key;
+                    keyCount++;
+                    valueHasChanged = true;
+
+                    textWidth += (glyphAdvances[GuiGetGlyphIndex(key)] + (float)GuiGetStyle(DEFAULT, TEXT_SPACING));
                 }
             }
 
@@ -2911,22 +3729,22 @@ int GuiValueBox(Rectangle bounds, const char *text, int *value, int minValue, in
     // Draw control
     //--------------------------------------------------------------------
     Color baseColor = BLANK;
-    if (state == STATE_PRESSED) baseColor = GetColor(GuiGetStyle(VALUEBOX, BASE_COLOR_PRESSED));
-    else if (state == STATE_DISABLED) baseColor = GetColor(GuiGetStyle(VALUEBOX, BASE_COLOR_DISABLED));
+    if (state == STATE_PRESSED) baseColor = GuiGetStyleColor(VALUEBOX, BASE_COLOR_PRESSED);
+    else if (state == STATE_DISABLED) baseColor = GuiGetStyleColor(VALUEBOX, BASE_COLOR_DISABLED);
 
-    GuiDrawRectangle(bounds, GuiGetStyle(VALUEBOX, BORDER_WIDTH), GetColor(GuiGetStyle(VALUEBOX, BORDER + (state*3))), baseColor);
-    GuiDrawText(textValue, GetTextBounds(VALUEBOX, bounds), TEXT_ALIGN_CENTER, GetColor(GuiGetStyle(VALUEBOX, TEXT + (state*3))));
+    GuiDrawRectangle(bounds, GuiGetStyle(VALUEBOX, BORDER_WIDTH), GuiGetStyleColor(VALUEBOX, BORDER + (state*3)), baseColor);
+    GuiDrawText(textValue, GetTextBounds(VALUEBOX, bounds), TEXT_ALIGN_CENTER, GuiGetStyleColor(VALUEBOX, TEXT + (state*3)));
 
     // Draw cursor
     if (editMode)
     {
         // NOTE: ValueBox internal text is always centered
         Rectangle cursor = { bounds.x + GetTextWidth(textValue)/2 + bounds.width/2 + 1, bounds.y + 2*GuiGetStyle(VALUEBOX, BORDER_WIDTH), 4, bounds.height - 4*GuiGetStyle(VALUEBOX, BORDER_WIDTH) };
-        GuiDrawRectangle(cursor, 0, BLANK, GetColor(GuiGetStyle(VALUEBOX, BORDER_COLOR_PRESSED)));
+        GuiDrawRectangle(cursor, 0, BLANK, GuiGetStyleColor(VALUEBOX, BORDER_COLOR_PRESSED));
     }
 
     // Draw text label if provided
-    GuiDrawText(text, textBounds, (GuiGetStyle(VALUEBOX, TEXT_ALIGNMENT) == TEXT_ALIGN_RIGHT)? TEXT_ALIGN_LEFT : TEXT_ALIGN_RIGHT, GetColor(GuiGetStyle(LABEL, TEXT + (state*3))));
+    GuiDrawText(text, textBounds, (GuiGetStyle(VALUEBOX, TEXT_ALIGNMENT) == TEXT_ALIGN_RIGHT)? TEXT_ALIGN_LEFT : TEXT_ALIGN_RIGHT, GuiGetStyleColor(LABEL, TEXT + (state*3)));
     //--------------------------------------------------------------------
 
     return result;
@@ -3025,12 +3843,12 @@ int GuiSliderPro(Rectangle bounds, const char *textLeft, const char *textRight,
 
     // Draw control
     //--------------------------------------------------------------------
-    GuiDrawRectangle(bounds, GuiGetStyle(SLIDER, BORDER_WIDTH), GetColor(GuiGetStyle(SLIDER, BORDER + (state*3))), GetColor(GuiGetStyle(SLIDER, (state != STATE_DISABLED)?  BASE_COLOR_NORMAL : BASE_COLOR_DISABLED)));
+    GuiDrawRectangle(bounds, GuiGetStyle(SLIDER, BORDER_WIDTH), GuiGetStyleColor(SLIDER, BORDER + (state*3)), GuiGetStyleColor(SLIDER, (state != STATE_DISABLED)?  BASE_COLOR_NORMAL : BASE_COLOR_DISABLED));
 
     // Draw slider internal bar (depends on state)
-    if (state == STATE_NORMAL) GuiDrawRectangle(slider, 0, BLANK, GetColor(GuiGetStyle(SLIDER, BASE_COLOR_PRESSED)));
-    else if (state == STATE_FOCUSED) GuiDrawRectangle(slider, 0, BLANK, GetColor(GuiGetStyle(SLIDER, TEXT_COLOR_FOCUSED)));
-    else if (state == STATE_PRESSED) GuiDrawRectangle(slider, 0, BLANK, GetColor(GuiGetStyle(SLIDER, TEXT_COLOR_PRESSED)));
+    if (state == STATE_NORMAL) GuiDrawRectangle(slider, 0, BLANK, GuiGetStyleColor(SLIDER, BASE_COLOR_PRESSED));
+    else if (state == STATE_FOCUSED) GuiDrawRectangle(slider, 0, BLANK, GuiGetStyleColor(SLIDER, TEXT_COLOR_FOCUSED));
+    else if (state == STATE_PRESSED) GuiDrawRectangle(slider, 0, BLANK, GuiGetStyleColor(SLIDER, TEXT_COLOR_PRESSED));
 
     // Draw left/right text if provided
     if (textLeft != NULL)
@@ -3041,7 +3859,7 @@ int GuiSliderPro(Rectangle bounds, const char *textLeft, const char *textRight,
         textBounds.x = bounds.x - textBounds.width - GuiGetStyle(SLIDER, TEXT_PADDING);
         textBounds.y = bounds.y + bounds.height/2 - GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
 
-        GuiDrawText(textLeft, textBounds, TEXT_ALIGN_RIGHT, GetColor(GuiGetStyle(SLIDER, TEXT + (state*3))));
+        GuiDrawText(textLeft, textBounds, TEXT_ALIGN_RIGHT, GuiGetStyleColor(SLIDER, TEXT + (state*3)));
     }
 
     if (textRight != NULL)
@@ -3052,7 +3870,7 @@ int GuiSliderPro(Rectangle bounds, const char *textLeft, const char *textRight,
         textBounds.x = bounds.x + bounds.width + GuiGetStyle(SLIDER, TEXT_PADDING);
         textBounds.y = bounds.y + bounds.height/2 - GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
 
-        GuiDrawText(textRight, textBounds, TEXT_ALIGN_LEFT, GetColor(GuiGetStyle(SLIDER, TEXT + (state*3))));
+        GuiDrawText(textRight, textBounds, TEXT_ALIGN_LEFT, GuiGetStyleColor(SLIDER, TEXT + (state*3)));
     }
     //--------------------------------------------------------------------
 
@@ -3097,30 +3915,30 @@ int GuiProgressBar(Rectangle bounds, const char *textLeft, const char *textRight
     //--------------------------------------------------------------------
     if (state == STATE_DISABLED)
     {
-        GuiDrawRectangle(bounds, GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), GetColor(GuiGetStyle(PROGRESSBAR, BORDER + (state*3))), BLANK);
+        GuiDrawRectangle(bounds, GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), GuiGetStyleColor(PROGRESSBAR, BORDER + (state*3)), BLANK);
     }
     else
     {
         if (*value > minValue)
         {
             // Draw progress bar with colored border, more visual
-            GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y, (int)progress.width + (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH) }, 0, BLANK, GetColor(GuiGetStyle(PROGRESSBAR, BORDER_COLOR_FOCUSED)));
-            GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + 1, (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), bounds.height - 2 }, 0, BLANK, GetColor(GuiGetStyle(PROGRESSBAR, BORDER_COLOR_FOCUSED)));
-            GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + bounds.height - 1, (int)progress.width + (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH) }, 0, BLANK, GetColor(GuiGetStyle(PROGRESSBAR, BORDER_COLOR_FOCUSED)));
+            GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y, (int)progress.width + (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH) }, 0, BLANK, GuiGetStyleColor(PROGRESSBAR, BORDER_COLOR_FOCUSED));
+            GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + 1, (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), bounds.height - 2 }, 0, BLANK, GuiGetStyleColor(PROGRESSBAR, BORDER_COLOR_FOCUSED));
+            GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + bounds.height - 1, (int)progress.width + (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH) }, 0, BLANK, GuiGetStyleColor(PROGRESSBAR, BORDER_COLOR_FOCUSED));
         }
-        else GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y, (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), bounds.height }, 0, BLANK, GetColor(GuiGetStyle(PROGRESSBAR, BORDER_COLOR_NORMAL)));
+        else GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y, (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), bounds.height }, 0, BLANK, GuiGetStyleColor(PROGRESSBAR, BORDER_COLOR_NORMAL));
 
-        if (*value >= maxValue) GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x + progress.width + 1, bounds.y, (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), bounds.height }, 0, BLANK, GetColor(GuiGetStyle(PROGRESSBAR, BORDER_COLOR_FOCUSED)));
+        if (*value >= maxValue) GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x + progress.width + 1, bounds.y, (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), bounds.height }, 0, BLANK, GuiGetStyleColor(PROGRESSBAR, BORDER_COLOR_FOCUSED));
         else
         {
             // Draw borders not yet reached by value
-            GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x + (int)progress.width + 1, bounds.y, bounds.width - (int)progress.width - 1, (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH) }, 0, BLANK, GetColor(GuiGetStyle(PROGRESSBAR, BORDER_COLOR_NORMAL)));
-            GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x + (int)progress.width + 1, bounds.y + bounds.height - 1, bounds.width - (int)progress.width - 1, (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH) }, 0, BLANK, GetColor(GuiGetStyle(PROGRESSBAR, BORDER_COLOR_NORMAL)));
-            GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x + bounds.width - 1, bounds.y + 1, (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), bounds.height - 2 }, 0, BLANK, GetColor(GuiGetStyle(PROGRESSBAR, BORDER_COLOR_NORMAL)));
+            GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x + (int)progress.width + 1, bounds.y, bounds.width - (int)progress.width - 1, (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH) }, 0, BLANK, GuiGetStyleColor(PROGRESSBAR, BORDER_COLOR_NORMAL));
+            GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x + (int)progress.width + 1, bounds.y + bounds.height - 1, bounds.width - (int)progress.width - 1, (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH) }, 0, BLANK, GuiGetStyleColor(PROGRESSBAR, BORDER_COLOR_NORMAL));
+            GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x + bounds.width - 1, bounds.y + 1, (float)GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), bounds.height - 2 }, 0, BLANK, GuiGetStyleColor(PROGRESSBAR, BORDER_COLOR_NORMAL));
         }
 
         // Draw slider internal progress bar (depends on state)
-        GuiDrawRectangle(progress, 0, BLANK, GetColor(GuiGetStyle(PROGRESSBAR, BASE_COLOR_PRESSED)));
+        GuiDrawRectangle(progress, 0, BLANK, GuiGetStyleColor(PROGRESSBAR, BASE_COLOR_PRESSED));
     }
 
     // Draw left/right text if provided
@@ -3132,7 +3950,7 @@ int GuiProgressBar(Rectangle bounds, const char *textLeft, const char *textRight
         textBounds.x = bounds.x - textBounds.width - GuiGetStyle(PROGRESSBAR, TEXT_PADDING);
         textBounds.y = bounds.y + bounds.height/2 - GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
 
-        GuiDrawText(textLeft, textBounds, TEXT_ALIGN_RIGHT, GetColor(GuiGetStyle(PROGRESSBAR, TEXT + (state*3))));
+        GuiDrawText(textLeft, textBounds, TEXT_ALIGN_RIGHT, GuiGetStyleColor(PROGRESSBAR, TEXT + (state*3)));
     }
 
     if (textRight != NULL)
@@ -3143,7 +3961,7 @@ int GuiProgressBar(Rectangle bounds, const char *textLeft, const char *textRight
         textBounds.x = bounds.x + bounds.width + GuiGetStyle(PROGRESSBAR, TEXT_PADDING);
         textBounds.y = bounds.y + bounds.height/2 - GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
 
-        GuiDrawText(textRight, textBounds, TEXT_ALIGN_LEFT, GetColor(GuiGetStyle(PROGRESSBAR, TEXT + (state*3))));
+        GuiDrawText(textRight, textBounds, TEXT_ALIGN_LEFT, GuiGetStyleColor(PROGRESSBAR, TEXT + (state*3)));
     }
     //--------------------------------------------------------------------
 
@@ -3158,8 +3976,8 @@ int GuiStatusBar(Rectangle bounds, const char *text)
 
     // Draw control
     //--------------------------------------------------------------------
-    GuiDrawRectangle(bounds, GuiGetStyle(STATUSBAR, BORDER_WIDTH), GetColor(GuiGetStyle(STATUSBAR, BORDER + (state*3))), GetColor(GuiGetStyle(STATUSBAR, BASE + (state*3))));
-    GuiDrawText(text, GetTextBounds(STATUSBAR, bounds), GuiGetStyle(STATUSBAR, TEXT_ALIGNMENT), GetColor(GuiGetStyle(STATUSBAR, TEXT + (state*3))));
+    GuiDrawRectangle(bounds, GuiGetStyle(STATUSBAR, BORDER_WIDTH), GuiGetStyleColor(STATUSBAR, BORDER + (state*3)), GuiGetStyleColor(STATUSBAR, BASE + (state*3)));
+    GuiDrawText(text, GetTextBounds(STATUSBAR, bounds), GuiGetStyle(STATUSBAR, TEXT_ALIGNMENT), GuiGetStyleColor(STATUSBAR, TEXT + (state*3)));
     //--------------------------------------------------------------------
 
     return result;
@@ -3188,8 +4006,8 @@ int GuiDummyRec(Rectangle bounds, const char *text)
 
     // Draw control
     //--------------------------------------------------------------------
-    GuiDrawRectangle(bounds, 0, BLANK, GetColor(GuiGetStyle(DEFAULT, (state != STATE_DISABLED)? BASE_COLOR_NORMAL : BASE_COLOR_DISABLED)));
-    GuiDrawText(text, GetTextBounds(DEFAULT, bounds), TEXT_ALIGN_CENTER, GetColor(GuiGetStyle(BUTTON, (state != STATE_DISABLED)? TEXT_COLOR_NORMAL : TEXT_COLOR_DISABLED)));
+    GuiDrawRectangle(bounds, 0, BLANK, GuiGetStyleColor(DEFAULT, (state != STATE_DISABLED)? BASE_COLOR_NORMAL : BASE_COLOR_DISABLED));
+    GuiDrawText(text, GetTextBounds(DEFAULT, bounds), TEXT_ALIGN_CENTER, GuiGetStyleColor(BUTTON, (state != STATE_DISABLED)? TEXT_COLOR_NORMAL : TEXT_COLOR_DISABLED));
     //------------------------------------------------------------------
 
     return result;
@@ -3288,35 +4106,35 @@ int GuiListViewEx(Rectangle bounds, const char **text, int count, int *scrollInd
 
     // Draw control
     //--------------------------------------------------------------------
-    GuiDrawRectangle(bounds, GuiGetStyle(DEFAULT, BORDER_WIDTH), GetColor(GuiGetStyle(LISTVIEW, BORDER + state*3)), GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));     // Draw background
+    GuiDrawRectangle(bounds, GuiGetStyle(DEFAULT, BORDER_WIDTH), GuiGetStyleColor(LISTVIEW, BORDER + state*3), GuiGetStyleColor(DEFAULT, BACKGROUND_COLOR));     // Draw background
 
     // Draw visible items
     for (int i = 0; ((i < visibleItems) && (text != NULL)); i++)
     {
         if (state == STATE_DISABLED)
         {
-            if ((startIndex + i) == itemSelected) GuiDrawRectangle(itemBounds, GuiGetStyle(LISTVIEW, BORDER_WIDTH), GetColor(GuiGetStyle(LISTVIEW, BORDER_COLOR_DISABLED)), GetColor(GuiGetStyle(LISTVIEW, BASE_COLOR_DISABLED)));
+            if ((startIndex + i) == itemSelected) GuiDrawRectangle(itemBounds, GuiGetStyle(LISTVIEW, BORDER_WIDTH), GuiGetStyleColor(LISTVIEW, BORDER_COLOR_DISABLED), GuiGetStyleColor(LISTVIEW, BASE_COLOR_DISABLED));
 
-            GuiDrawText(text[startIndex + i], GetTextBounds(DEFAULT, itemBounds), GuiGetStyle(LISTVIEW, TEXT_ALIGNMENT), GetColor(GuiGetStyle(LISTVIEW, TEXT_COLOR_DISABLED)));
+            GuiDrawText(text[startIndex + i], GetTextBounds(DEFAULT, itemBounds), GuiGetStyle(LISTVIEW, TEXT_ALIGNMENT), GuiGetStyleColor(LISTVIEW, TEXT_COLOR_DISABLED));
         }
         else
         {
             if (((startIndex + i) == itemSelected) && (active != NULL))
             {
                 // Draw item selected
-                GuiDrawRectangle(itemBounds, GuiGetStyle(LISTVIEW, BORDER_WIDTH), GetColor(GuiGetStyle(LISTVIEW, BORDER_COLOR_PRESSED)), GetColor(GuiGetStyle(LISTVIEW, BASE_COLOR_PRESSED)));
-                GuiDrawText(text[startIndex + i], GetTextBounds(DEFAULT, itemBounds), GuiGetStyle(LISTVIEW, TEXT_ALIGNMENT), GetColor(GuiGetStyle(LISTVIEW, TEXT_COLOR_PRESSED)));
+                GuiDrawRectangle(itemBounds, GuiGetStyle(LISTVIEW, BORDER_WIDTH), GuiGetStyleColor(LISTVIEW, BORDER_COLOR_PRESSED), GuiGetStyleColor(LISTVIEW, BASE_COLOR_PRESSED));
+                GuiDrawText(text[startIndex + i], GetTextBounds(DEFAULT, itemBounds), GuiGetStyle(LISTVIEW, TEXT_ALIGNMENT), GuiGetStyleColor(LISTVIEW, TEXT_COLOR_PRESSED));
             }
             else if (((startIndex + i) == itemFocused)) // && (focus != NULL))  // NOTE: We want items focused, despite not returned!
             {
                 // Draw item focused
-                GuiDrawRectangle(itemBounds, GuiGetStyle(LISTVIEW, BORDER_WIDTH), GetColor(GuiGetStyle(LISTVIEW, BORDER_COLOR_FOCUSED)), GetColor(GuiGetStyle(LISTVIEW, BASE_COLOR_FOCUSED)));
-                GuiDrawText(text[startIndex + i], GetTextBounds(DEFAULT, itemBounds), GuiGetStyle(LISTVIEW, TEXT_ALIGNMENT), GetColor(GuiGetStyle(LISTVIEW, TEXT_COLOR_FOCUSED)));
+                GuiDrawRectangle(itemBounds, GuiGetStyle(LISTVIEW, BORDER_WIDTH), GuiGetStyleColor(LISTVIEW, BORDER_COLOR_FOCUSED), GuiGetStyleColor(LISTVIEW, BASE_COLOR_FOCUSED));
+                GuiDrawText(text[startIndex + i], GetTextBounds(DEFAULT, itemBounds), GuiGetStyle(LISTVIEW, TEXT_ALIGNMENT), GuiGetStyleColor(LISTVIEW, TEXT_COLOR_FOCUSED));
             }
             else
             {
                 // Draw item normal
-                GuiDrawText(text[startIndex + i], GetTextBounds(DEFAULT, itemBounds), GuiGetStyle(LISTVIEW, TEXT_ALIGNMENT), GetColor(GuiGetStyle(LISTVIEW, TEXT_COLOR_NORMAL)));
+                GuiDrawText(text[startIndex + i], GetTextBounds(DEFAULT, itemBounds), GuiGetStyle(LISTVIEW, TEXT_ALIGNMENT), GuiGetStyleColor(LISTVIEW, TEXT_COLOR_NORMAL));
             }
         }
 
@@ -3336,15 +4154,13 @@ int GuiListViewEx(Rectangle bounds, const char **text, int count, int *scrollInd
         float percentVisible = (float)(endIndex - startIndex)/count;
         float sliderSize = bounds.height*percentVisible;
 
-        int prevSliderSize = GuiGetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE);   // Save default slider size
-        int prevScrollSpeed = GuiGetStyle(SCROLLBAR, SCROLL_SPEED); // Save default scroll speed
-        GuiSetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE, (int)sliderSize);            // Change slider size
-        GuiSetStyle(SCROLLBAR, SCROLL_SPEED, count - visibleItems); // Change scroll speed
+        GuiPushStyle(SCROLLBAR, SCROLL_SLIDER_SIZE, (int)sliderSize);            // Change slider size
+        GuiPushStyle(SCROLLBAR, SCROLL_SPEED, count - visibleItems); // Change scroll speed
 
         startIndex = GuiScrollBar(scrollBarBounds, startIndex, 0, count - visibleItems);
 
-        GuiSetStyle(SCROLLBAR, SCROLL_SPEED, prevScrollSpeed); // Reset scroll speed to default
-        GuiSetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE, prevSliderSize); // Reset slider size to default
+        GuiPopStyle();
+        GuiPopStyle();
     }
     //--------------------------------------------------------------------
 
@@ -3456,19 +4272,19 @@ int GuiColorPanel(Rectangle bounds, const char *text, Color *color)
     //--------------------------------------------------------------------
     if (state != STATE_DISABLED)
     {
-        DrawRectangleGradientEx(bounds, Fade(colWhite, guiAlpha), Fade(colWhite, guiAlpha), Fade(maxHueCol, guiAlpha), Fade(maxHueCol, guiAlpha));
-        DrawRectangleGradientEx(bounds, Fade(colBlack, 0), Fade(colBlack, guiAlpha), Fade(colBlack, guiAlpha), Fade(colBlack, 0));
+        GuiDrawRectangleGradient(bounds, Fade(colWhite, guiAlpha), Fade(colWhite, guiAlpha), Fade(maxHueCol, guiAlpha), Fade(maxHueCol, guiAlpha));
+        GuiDrawRectangleGradient(bounds, Fade(colBlack, 0), Fade(colBlack, guiAlpha), Fade(colBlack, guiAlpha), Fade(colBlack, 0));
 
         // Draw color picker: selector
         Rectangle selector = { pickerSelector.x - GuiGetStyle(COLORPICKER, COLOR_SELECTOR_SIZE)/2, pickerSelector.y - GuiGetStyle(COLORPICKER, COLOR_SELECTOR_SIZE)/2, (float)GuiGetStyle(COLORPICKER, COLOR_SELECTOR_SIZE), (float)GuiGetStyle(COLORPICKER, COLOR_SELECTOR_SIZE) };
-        GuiDrawRectangle(selector, 0, BLANK, colWhite);
+        GuiDrawRectangle(selector, 0, BLANK, GuiFade(colWhite, guiAlpha));
     }
     else
     {
-        DrawRectangleGradientEx(bounds, Fade(Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), guiAlpha), Fade(Fade(colBlack, 0.6f), guiAlpha), Fade(Fade(colBlack, 0.6f), guiAlpha), Fade(Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), 0.6f), guiAlpha));
+        GuiDrawRectangleGradient(bounds, Fade(Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), guiAlpha), Fade(Fade(colBlack, 0.6f), guiAlpha), Fade(Fade(colBlack, 0.6f), guiAlpha), Fade(Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), 0.6f), guiAlpha));
     }
 
-    GuiDrawRectangle(bounds, GuiGetStyle(COLORPICKER, BORDER_WIDTH), GetColor(GuiGetStyle(COLORPICKER, BORDER + state*3)), BLANK);
+    GuiDrawRectangle(bounds, GuiGetStyle(COLORPICKER, BORDER_WIDTH), GuiGetStyleColor(COLORPICKER, BORDER + state*3), BLANK);
     //--------------------------------------------------------------------
 
     return result;
@@ -3543,18 +4359,18 @@ int GuiColorBarAlpha(Rectangle bounds, const char *text, float *alpha)
             for (int y = 0; y < checksY; y++)
             {
                 Rectangle check = { bounds.x + x*RAYGUI_COLORBARALPHA_CHECKED_SIZE, bounds.y + y*RAYGUI_COLORBARALPHA_CHECKED_SIZE, RAYGUI_COLORBARALPHA_CHECKED_SIZE, RAYGUI_COLORBARALPHA_CHECKED_SIZE };
-                GuiDrawRectangle(check, 0, BLANK, ((x + y)%2)? Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), 0.4f) : Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.4f));
+                GuiDrawRectangle(check, 0, BLANK, ((x + y)%2)? GuiFade(Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), 0.4f), guiAlpha) : GuiFade(Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.4f), guiAlpha));
             }
         }
 
-        DrawRectangleGradientEx(bounds, RAYGUI_CLITERAL(Color){ 255, 255, 255, 0 }, RAYGUI_CLITERAL(Color){ 255, 255, 255, 0 }, Fade(RAYGUI_CLITERAL(Color){ 0, 0, 0, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 0, 0, 0, 255 }, guiAlpha));
+        GuiDrawRectangleGradient(bounds, RAYGUI_CLITERAL(Color){ 255, 255, 255, 0 }, RAYGUI_CLITERAL(Color){ 255, 255, 255, 0 }, Fade(RAYGUI_CLITERAL(Color){ 0, 0, 0, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 0, 0, 0, 255 }, guiAlpha));
     }
-    else DrawRectangleGradientEx(bounds, Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), guiAlpha), Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), guiAlpha));
+    else GuiDrawRectangleGradient(bounds, Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), guiAlpha), Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), guiAlpha));
 
-    GuiDrawRectangle(bounds, GuiGetStyle(COLORPICKER, BORDER_WIDTH), GetColor(GuiGetStyle(COLORPICKER, BORDER + state*3)), BLANK);
+    GuiDrawRectangle(bounds, GuiGetStyle(COLORPICKER, BORDER_WIDTH), GuiGetStyleColor(COLORPICKER, BORDER + state*3), BLANK);
 
     // Draw alpha bar: selector
-    GuiDrawRectangle(selector, 0, BLANK, GetColor(GuiGetStyle(COLORPICKER, BORDER + state*3)));
+    GuiDrawRectangle(selector, 0, BLANK, GuiGetStyleColor(COLORPICKER, BORDER + state*3));
     //--------------------------------------------------------------------
 
     return result;
@@ -3630,21 +4446,34 @@ int GuiColorBarHue(Rectangle bounds, const char *text, float *hue)
     //--------------------------------------------------------------------
     if (state != STATE_DISABLED)
     {
-        // Draw hue bar:color bars
-        // TODO: Use directly DrawRectangleGradientEx(bounds, color1, color2, color2, color1);
-        DrawRectangleGradientV((int)bounds.x, (int)(bounds.y), (int)bounds.width, (int)ceilf(bounds.height/6), Fade(RAYGUI_CLITERAL(Color){ 255, 0, 0, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 255, 255, 0, 255 }, guiAlpha));
-        DrawRectangleGradientV((int)bounds.x, (int)(bounds.y + bounds.height/6), (int)bounds.width, (int)ceilf(bounds.height/6), Fade(RAYGUI_CLITERAL(Color){ 255, 255, 0, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 0, 255, 0, 255 }, guiAlpha));
-        DrawRectangleGradientV((int)bounds.x, (int)(bounds.y + 2*(bounds.height/6)), (int)bounds.width, (int)ceilf(bounds.height/6), Fade(RAYGUI_CLITERAL(Color){ 0, 255, 0, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 0, 255, 255, 255 }, guiAlpha));
-        DrawRectangleGradientV((int)bounds.x, (int)(bounds.y + 3*(bounds.height/6)), (int)bounds.width, (int)ceilf(bounds.height/6), Fade(RAYGUI_CLITERAL(Color){ 0, 255, 255, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 0, 0, 255, 255 }, guiAlpha));
-        DrawRectangleGradientV((int)bounds.x, (int)(bounds.y + 4*(bounds.height/6)), (int)bounds.width, (int)ceilf(bounds.height/6), Fade(RAYGUI_CLITERAL(Color){ 0, 0, 255, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 255, 0, 255, 255 }, guiAlpha));
-        DrawRectangleGradientV((int)bounds.x, (int)(bounds.y + 5*(bounds.height/6)), (int)bounds.width, (int)(bounds.height/6), Fade(RAYGUI_CLITERAL(Color){ 255, 0, 255, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 255, 0, 0, 255 }, guiAlpha));
+        // Draw hue bar: color bars, one vertical gradient per hue section
+        Color hueColors[7] = {
+            RAYGUI_CLITERAL(Color){ 255, 0, 0, 255 }, RAYGUI_CLITERAL(Color){ 255, 255, 0, 255 }, RAYGUI_CLITERAL(Color){ 0, 255, 0, 255 },
+            RAYGUI_CLITERAL(Color){ 0, 255, 255, 255 }, RAYGUI_CLITERAL(Color){ 0, 0, 255, 255 }, RAYGUI_CLITERAL(Color){ 255, 0, 255, 255 },
+            RAYGUI_CLITERAL(Color){ 255, 0, 0, 255 }
+        };
+
+        for (int i = 0; i < 6; i++)
+        {
+            Color colTop = Fade(hueColors[i], guiAlpha);
+            Color colBottom = Fade(hueColors[i + 1], guiAlpha);
+            Rectangle section = { (float)((int)bounds.x), (float)((int)(bounds.y + i*(bounds.height/6))), (float)((int)bounds.width), (i < 5)? ceilf(bounds.height/6) : (float)((int)(bounds.height/6)) };
+
+            GuiDrawRectangleGradient(section, colTop, colBottom, colBottom, colTop);
+        }
+    }
+    else
+    {
+        Color colTop = Fade(Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), guiAlpha);
+        Color colBottom = Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), guiAlpha);
+
+        GuiDrawRectangleGradient(RAYGUI_CLITERAL(Rectangle){ (float)((int)bounds.x), (float)((int)bounds.y), (float)((int)bounds.width), (float)((int)bounds.height) }, colTop, colBottom, colBottom, colTop);
     }
-    else DrawRectangleGradientV((int)bounds.x, (int)bounds.y, (int)bounds.width, (int)bounds.height, Fade(Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), guiAlpha), Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), guiAlpha));
 
-    GuiDrawRectangle(bounds, GuiGetStyle(COLORPICKER, BORDER_WIDTH), GetColor(GuiGetStyle(COLORPICKER, BORDER + state*3)), BLANK);
+    GuiDrawRectangle(bounds, GuiGetStyle(COLORPICKER, BORDER_WIDTH), GuiGetStyleColor(COLORPICKER, BORDER + state*3), BLANK);
 
     // Draw hue bar: selector
-    GuiDrawRectangle(selector, 0, BLANK, GetColor(GuiGetStyle(COLORPICKER, BORDER + state*3)));
+    GuiDrawRectangle(selector, 0, BLANK, GuiGetStyleColor(COLORPICKER, BORDER + state*3));
     //--------------------------------------------------------------------
 
     return result;
@@ -3760,19 +4589,19 @@ int GuiColorPanelHSV(Rectangle bounds, const char *text, Vector3 *colorHsv)
     //--------------------------------------------------------------------
     if (state != STATE_DISABLED)
     {
-        DrawRectangleGradientEx(bounds, Fade(colWhite, guiAlpha), Fade(colWhite, guiAlpha), Fade(maxHueCol, guiAlpha), Fade(maxHueCol, guiAlpha));
-        DrawRectangleGradientEx(bounds, Fade(colBlack, 0), Fade(colBlack, guiAlpha), Fade(colBlack, guiAlpha), Fade(colBlack, 0));
+        GuiDrawRectangleGradient(bounds, Fade(colWhite, guiAlpha), Fade(colWhite, guiAlpha), Fade(maxHueCol, guiAlpha), Fade(maxHueCol, guiAlpha));
+        GuiDrawRectangleGradient(bounds, Fade(colBlack, 0), Fade(colBlack, guiAlpha), Fade(colBlack, guiAlpha), Fade(colBlack, 0));
 
         // Draw color picker: selector
         Rectangle selector = { pickerSelector.x - GuiGetStyle(COLORPICKER, COLOR_SELECTOR_SIZE)/2, pickerSelector.y - GuiGetStyle(COLORPICKER, COLOR_SELECTOR_SIZE)/2, (float)GuiGetStyle(COLORPICKER, COLOR_SELECTOR_SIZE), (float)GuiGetStyle(COLORPICKER, COLOR_SELECTOR_SIZE) };
-        GuiDrawRectangle(selector, 0, BLANK, colWhite);
+        GuiDrawRectangle(selector, 0, BLANK, GuiFade(colWhite, guiAlpha));
     }
     else
     {
-        DrawRectangleGradientEx(bounds, Fade(Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), guiAlpha), Fade(Fade(colBlack, 0.6f), guiAlpha), Fade(Fade(colBlack, 0.6f), guiAlpha), Fade(Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), 0.6f), guiAlpha));
+        GuiDrawRectangleGradient(bounds, Fade(Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), guiAlpha), Fade(Fade(colBlack, 0.6f), guiAlpha), Fade(Fade(colBlack, 0.6f), guiAlpha), Fade(Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), 0.6f), guiAlpha));
     }
 
-    GuiDrawRectangle(bounds, GuiGetStyle(COLORPICKER, BORDER_WIDTH), GetColor(GuiGetStyle(COLORPICKER, BORDER + state*3)), BLANK);
+    GuiDrawRectangle(bounds, GuiGetStyle(COLORPICKER, BORDER_WIDTH), GuiGetStyleColor(COLORPICKER, BORDER + state*3), BLANK);
     //--------------------------------------------------------------------
 
     return result;
@@ -3810,13 +4639,11 @@ int GuiMessageBox(Rectangle bounds, const char *title, const char *message, cons
     //--------------------------------------------------------------------
     if (GuiWindowBox(bounds, title)) result = 0;
 
-    int prevTextAlignment = GuiGetStyle(LABEL, TEXT_ALIGNMENT);
-    GuiSetStyle(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
+    GuiPushStyle(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
     GuiLabel(textBounds, message);
-    GuiSetStyle(LABEL, TEXT_ALIGNMENT, prevTextAlignment);
+    GuiPopStyle();
 
-    prevTextAlignment = GuiGetStyle(BUTTON, TEXT_ALIGNMENT);
-    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
+    GuiPushStyle(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
 
     for (int i = 0; i < buttonCount; i++)
     {
@@ -3824,7 +4651,7 @@ int GuiMessageBox(Rectangle bounds, const char *title, const char *message, cons
         buttonBounds.x += (buttonBounds.width + RAYGUI_MESSAGEBOX_BUTTON_PADDING);
     }
 
-    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, prevTextAlignment);
+    GuiPopStyle();
     //--------------------------------------------------------------------
 
     return result;
@@ -3885,10 +4712,9 @@ int GuiTextInputBox(Rectangle bounds, const char *title, const char *message, co
     // Draw message if available
     if (message != NULL)
     {
-        int prevTextAlignment = GuiGetStyle(LABEL, TEXT_ALIGNMENT);
-        GuiSetStyle(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
+        GuiPushStyle(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
         GuiLabel(textBounds, message);
-        GuiSetStyle(LABEL, TEXT_ALIGNMENT, prevTextAlignment);
+        GuiPopStyle();
     }
 
     if (secretViewActive != NULL)
@@ -3904,8 +4730,7 @@ int GuiTextInputBox(Rectangle bounds, const char *title, const char *message, co
         if (GuiTextBox(textBoxBounds, text, textMaxSize, textEditMode)) textEditMode = !textEditMode;
     }
 
-    int prevBtnTextAlignment = GuiGetStyle(BUTTON, TEXT_ALIGNMENT);
-    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
+    GuiPushStyle(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
 
     for (int i = 0; i < buttonCount; i++)
     {
@@ -3915,7 +4740,7 @@ int GuiTextInputBox(Rectangle bounds, const char *title, const char *message, co
 
     if (result >= 0) textEditMode = false;
 
-    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, prevBtnTextAlignment);
+    GuiPopStyle();
     //--------------------------------------------------------------------
 
     return result;      // Result is the pressed button index
@@ -3967,14 +4792,14 @@ int GuiGrid(Rectangle bounds, const char *text, float spacing, int subdivs, Vect
         for (int i = 0; i < linesV; i++)
         {
             Rectangle lineV = { bounds.x + spacing*i/subdivs, bounds.y, 1, bounds.height };
-            GuiDrawRectangle(lineV, 0, BLANK, ((i%subdivs) == 0)? GuiFade(GetColor(color), RAYGUI_GRID_ALPHA*4) : GuiFade(GetColor(color), RAYGUI_GRID_ALPHA));
+            GuiDrawRectangle(lineV, 0, BLANK, ((i%subdivs) == 0)? GuiFade(GetColor(color), RAYGUI_GRID_ALPHA*4*guiAlpha) : GuiFade(GetColor(color), RAYGUI_GRID_ALPHA*guiAlpha));
         }
 
         // Draw horizontal grid lines
         for (int i = 0; i < linesH; i++)
         {
             Rectangle lineH = { bounds.x, bounds.y + spacing*i/subdivs, bounds.width, 1 };
-            GuiDrawRectangle(lineH, 0, BLANK, ((i%subdivs) == 0)? GuiFade(GetColor(color), RAYGUI_GRID_ALPHA*4) : GuiFade(GetColor(color), RAYGUI_GRID_ALPHA));
+            GuiDrawRectangle(lineH, 0, BLANK, ((i%subdivs) == 0)? GuiFade(GetColor(color), RAYGUI_GRID_ALPHA*4*guiAlpha) : GuiFade(GetColor(color), RAYGUI_GRID_ALPHA*guiAlpha));
         }
     }
 
@@ -3995,124 +4820,734 @@ void GuiDisableTooltip(void) { guiTooltip = false; }
 // Set tooltip string
 void GuiSetTooltip(const char *tooltip) { guiTooltipPtr = tooltip; }
 
-
 //----------------------------------------------------------------------------------
-// Styles loading functions
+// Draw commands functions
+// NOTE: Commands are only recorded if RAYGUI_COMMAND_LIST is defined,
+// otherwise drawing is done immediately and those functions do nothing
 //----------------------------------------------------------------------------------
+// Set custom callback to process draw commands on flush
+// NOTE: If no callback is set, commands are processed using backend drawing functions
+void GuiSetDrawCommandsCallback(GuiDrawCommandsCallback callback)
+{
+#if defined(RAYGUI_COMMAND_LIST)
+    guiDrawCommandsCallback = callback;
+#else
+    (void)callback;
+#endif
+}
 
-// Load raygui style file (.rgs)
-// NOTE: By default a binary file is expected, that file could contain a custom font,
-// in that case, custom font image atlas is GRAY+ALPHA and pixel data can be compressed (DEFLATE)
-void GuiLoadStyle(const char *fileName)
+// Get draw commands recorded since last flush
+const GuiDrawCommand *GuiGetDrawCommands(int *count)
 {
-    #define MAX_LINE_BUFFER_SIZE    256
+#if defined(RAYGUI_COMMAND_LIST)
+    *count = guiDrawCommandCount;
+    return guiDrawCommands;
+#else
+    *count = 0;
+    return NULL;
+#endif
+}
 
-    bool tryBinary = false;
+// Submit recorded draw commands to backend and clear list
+void GuiFlush(void)
+{
+#if defined(RAYGUI_COMMAND_LIST)
+    if (guiDrawCommandCount == 0) return;
 
-    // Try reading the files as text file first
-    FILE *rgsFile = fopen(fileName, "rt");
+    // NOTE: Commands count is reset before processing to allow
+    // custom callback to use any raygui drawing function
+    int count = guiDrawCommandCount;
+    guiDrawCommandCount = 0;
 
-    if (rgsFile != NULL)
+    if (guiDrawCommandsCallback != NULL) guiDrawCommandsCallback(guiDrawCommands, count);
+    else
     {
-        char buffer[MAX_LINE_BUFFER_SIZE] = { 0 };
-        fgets(buffer, MAX_LINE_BUFFER_SIZE, rgsFile);
-
-        if (buffer[0] == '#')
+        for (int i = 0; i < count; i++)
         {
-            int controlId = 0;
-            int propertyId = 0;
-            unsigned int propertyValue = 0;
+            const GuiDrawCommand *command = &guiDrawCommands[i];
 
-            while (!feof(rgsFile))
+            switch (command->type)
             {
-                switch (buffer[0])
-                {
-                    case 'p':
-                    {
-                        // Style property: p <control_id> <property_id> <property_value> <property_name>
+                case GUI_COMMAND_RECTANGLE: DrawRectangle((int)command->rec.x, (int)command->rec.y, (int)command->rec.width, (int)command->rec.height, command->colors[0]); break;
+                case GUI_COMMAND_RECTANGLE_GRADIENT: DrawRectangleGradientEx(command->rec, command->colors[0], command->colors[1], command->colors[2], command->colors[3]); break;
+                case GUI_COMMAND_GLYPH: GuiDrawGlyphTexture(command->value, RAYGUI_CLITERAL(Vector2){ command->rec.x, command->rec.y }, command->size, command->colors[0]); break;
+            #if !defined(RAYGUI_NO_ICONS) && defined(RAYGUI_ICON_ATLAS)
+                case GUI_COMMAND_ICON: GuiDrawIconAtlas(command->value, (int)command->rec.x, (int)command->rec.y, (int)command->size, command->colors[0]); break;
+            #elif !defined(RAYGUI_NO_ICONS)
+                case GUI_COMMAND_ICON: GuiDrawIconPixels(command->value, (int)command->rec.x, (int)command->rec.y, (int)command->size, command->colors[0]); break;
+            #endif
+                default: break;
+            }
+        }
+    }
+#endif
+}
 
-                        sscanf(buffer, "p %d %d 0x%x", &controlId, &propertyId, &propertyValue);
-                        GuiSetStyle(controlId, propertyId, (int)propertyValue);
+// End gui frame, get regions damaged since previous frame
+// NOTE: Draw items recorded this frame are matched with previous frame ones by identity, regions covered
+// by changed, added or removed items are returned as integer aligned and not overlapping rectangles,
+// backend only needs to redraw recorded commands inside them, if no region is damaged (count = 0),
+// recorded commands are discarded and frame could be skipped. NULL is returned if damage is not tracked
+// (RAYGUI_COMMAND_LIST not defined or first GuiEndFrame() call), whole frame must be redrawn (count = 1)
+// WARNING: Draw items are tracked after first GuiEndFrame() call, unless RAYGUI_DAMAGE_TRACKING is defined
+const Rectangle *GuiEndFrame(int *count)
+{
+#if defined(RAYGUI_COMMAND_LIST)
+    if (!guiDamageTracking)
+    {
+        // Draw items tracking enabled, current frame items were not tracked
+        guiDamageTracking = true;
+        guiDamageFull = false;
+        guiDrawItemCount[0] = 0;
+        guiDrawItemCount[1] = 0;
+
+        *count = 1;
+        return NULL;
+    }
 
-                    } break;
-                    case 'f':
-                    {
-                        // Style font: f <gen_font_size> <charmap_file> <font_file>
+    GuiDrawItem *previous = guiDrawItems[guiDrawItemFrame^1];
+    GuiDrawItem *current = guiDrawItems[guiDrawItemFrame];
+    int previousCount = guiDrawItemCount[guiDrawItemFrame^1];
+    int currentCount = guiDrawItemCount[guiDrawItemFrame];
 
-                        int fontSize = 0;
-                        char charmapFileName[256] = { 0 };
-                        char fontFileName[256] = { 0 };
-                        sscanf(buffer, "f %d %s %[^\r\n]s", &fontSize, charmapFileName, fontFileName);
+    guiDrawItemActive = NULL;
+    guiDamageRecCount = 0;
 
-                        Font font = { 0 };
-                        int *codepoints = NULL;
-                        int codepointCount = 0;
+    if (guiDamageFull)
+    {
+        // Whole frame damaged, all items bounds from both frames
+        Rectangle bounds = { 0 };
 
-                        if (charmapFileName[0] != '0')
-                        {
-                            // Load text data from file
-                            // NOTE: Expected an UTF-8 array of codepoints, no separation
-                            char *textData = LoadFileText(TextFormat("%s/%s", GetDirectoryPath(fileName), charmapFileName));
-                            codepoints = LoadCodepoints(textData, &codepointCount);
-                            UnloadFileText(textData);
-                        }
+        for (int i = 0; i < previousCount + currentCount; i++)
+        {
+            Rectangle rec = (i < previousCount)? previous[i].bounds : current[i - previousCount].bounds;
 
-                        if (fontFileName[0] != '\0')
-                        {
-                            // In case a font is already loaded and it is not default internal font, unload it
-                            if (font.texture.id != GetFontDefault().texture.id) UnloadTexture(font.texture);
+            if ((rec.width <= 0) || (rec.height <= 0)) continue;
+            if ((bounds.width <= 0) || (bounds.height <= 0)) bounds = rec;
+            else
+            {
+                float x1 = fmaxf(bounds.x + bounds.width, rec.x + rec.width);
+                float y1 = fmaxf(bounds.y + bounds.height, rec.y + rec.height);
+                bounds.x = fminf(bounds.x, rec.x);
+                bounds.y = fminf(bounds.y, rec.y);
+                bounds.width = x1 - bounds.x;
+                bounds.height = y1 - bounds.y;
+            }
+        }
 
-                            if (codepointCount > 0) font = LoadFontEx(TextFormat("%s/%s", GetDirectoryPath(fileName), fontFileName), fontSize, codepoints, codepointCount);
-                            else font = LoadFontEx(TextFormat("%s/%s", GetDirectoryPath(fileName), fontFileName), fontSize, NULL, 0);   // Default to 95 standard codepoints
-                        }
+        GuiAddDamageRec(bounds);
+        guiDamageFull = false;
+    }
+    else
+    {
+        // Previous frame items lookup by identity
+        const int lookupSize = 2*RAYGUI_MAX_DRAW_ITEMS;
+        memset(guiDrawItemLookup, 0, sizeof(guiDrawItemLookup));
 
-                        // If font texture not properly loaded, revert to default font and size/spacing
-                        if (font.texture.id == 0)
-                        {
-                            font = GetFontDefault();
-                            GuiSetStyle(DEFAULT, TEXT_SIZE, 10);
-                            GuiSetStyle(DEFAULT, TEXT_SPACING, 1);
-                        }
+        for (int i = 0; i < previousCount; i++)
+        {
+            int slot = (int)(previous[i].key%lookupSize);
+            while (guiDrawItemLookup[slot] != 0) slot = (slot + 1)%lookupSize;
 
-                        UnloadCodepoints(codepoints);
+            guiDrawItemLookup[slot] = i + 1;
+            previous[i].matched = false;
+        }
+
+        // Current items matched with first previous item not matched with same identity
+        for (int i = 0; i < currentCount; i++)
+        {
+            GuiDrawItem *match = NULL;
 
-                        if ((font.texture.id > 0) && (font.glyphCount > 0)) GuiSetFont(font);
+            for (int slot = (int)(current[i].key%lookupSize); guiDrawItemLookup[slot] != 0; slot = (slot + 1)%lookupSize)
+            {
+                GuiDrawItem *item = &previous[guiDrawItemLookup[slot] - 1];
 
-                    } break;
-                    default: break;
+                if ((item->key == current[i].key) && !item->matched)
+                {
+                    match = item;
+                    break;
                 }
+            }
+
+            if (match == NULL) GuiAddDamageRec(current[i].bounds);
+            else
+            {
+                match->matched = true;
 
-                fgets(buffer, MAX_LINE_BUFFER_SIZE, rgsFile);
+                if (match->hash != current[i].hash)
+                {
+                    GuiAddDamageRec(match->bounds);
+                    GuiAddDamageRec(current[i].bounds);
+                }
             }
         }
-        else tryBinary = true;
 
-        fclose(rgsFile);
+        // Previous items not drawn anymore
+        for (int i = 0; i < previousCount; i++) if (!previous[i].matched) GuiAddDamageRec(previous[i].bounds);
     }
 
-    if (tryBinary)
-    {
-        rgsFile = fopen(fileName, "rb");
+    // Current frame items become previous frame items
+    guiDrawItemFrame ^= 1;
+    guiDrawItemCount[guiDrawItemFrame] = 0;
 
-        if (rgsFile != NULL)
-        {
-            fseek(rgsFile, 0, SEEK_END);
-            int fileDataSize = ftell(rgsFile);
-            fseek(rgsFile, 0, SEEK_SET);
+    // Nothing changed, recorded commands are not required
+    if (guiDamageRecCount == 0) guiDrawCommandCount = 0;
 
-            if (fileDataSize > 0)
-            {
-                unsigned char *fileData = (unsigned char *)RAYGUI_MALLOC(fileDataSize*sizeof(unsigned char));
-                fread(fileData, sizeof(unsigned char), fileDataSize, rgsFile);
+    *count = guiDamageRecCount;
+    return guiDamageRecs;
+#else
+    *count = 1;
+    return NULL;
+#endif
+}
 
-                GuiLoadStyleFromMemory(fileData, fileDataSize);
+//----------------------------------------------------------------------------------
+// Text buffer functions
+//----------------------------------------------------------------------------------
+// Load text buffer for editing with GuiTextBoxEx()
+// NOTE: Provided text is copied, cursor (gap) is placed at the end of the text
+GuiTextBuffer GuiLoadTextBuffer(const char *text, int capacity)
+{
+    GuiTextBuffer buffer = { 0 };
 
-                RAYGUI_FREE(fileData);
-            }
+    int length = (text != NULL)? (int)strlen(text) : 0;
+    if (capacity < (length + RAYGUI_TEXT_BUFFER_GAP_SIZE)) capacity = length + RAYGUI_TEXT_BUFFER_GAP_SIZE;
 
-            fclose(rgsFile);
-        }
-    }
+    buffer.data = (char *)RAYGUI_MALLOC(capacity);
+    buffer.capacity = capacity;
+    buffer.length = length;
+    buffer.gapStart = length;
+    buffer.gapEnd = capacity;
+    if (length > 0) memcpy(buffer.data, text, length);
+
+    buffer.lineCapacity = 64;
+    buffer.lineStarts = (int *)RAYGUI_MALLOC(buffer.lineCapacity*sizeof(int));
+    buffer.lineStarts[0] = 0;
+    buffer.lineCount = 1;
+
+    for (int i = 0; i < length; i++)
+    {
+        if (text[i] == '\n') GuiTextBufferInsertLine(&buffer, buffer.lineCount, i + 1);
+    }
+
+    return buffer;
+}
+
+// Unload text buffer
+void GuiUnloadTextBuffer(GuiTextBuffer buffer)
+{
+    RAYGUI_FREE(buffer.data);
+    RAYGUI_FREE(buffer.lineStarts);
+}
+
+// Get text buffer range as text view
+// NOTE: Text view points to text buffer data, it is only valid until next text buffer edition
+GuiTextView GuiGetTextBufferView(GuiTextBuffer buffer, int position, int size)
+{
+    GuiTextView view = { 0 };
+
+    if (position < 0) position = 0;
+    if (position > buffer.length) position = buffer.length;
+    if ((position + size) > buffer.length) size = buffer.length - position;
+
+    int end = position + size;
+
+    if (position < buffer.gapStart)
+    {
+        view.first = buffer.data + position;
+        view.firstSize = ((end < buffer.gapStart)? end : buffer.gapStart) - position;
+    }
+
+    if (end > buffer.gapStart)
+    {
+        int start = (position > buffer.gapStart)? position : buffer.gapStart;
+
+        view.second = buffer.data + start + (buffer.gapEnd - buffer.gapStart);
+        view.secondSize = end - start;
+    }
+
+    return view;
+}
+
+// Get text buffer line as text view, line break not included
+GuiTextView GuiGetTextBufferLine(GuiTextBuffer buffer, int line)
+{
+    GuiTextView view = { 0 };
+
+    if ((line >= 0) && (line < buffer.lineCount))
+    {
+        view = GuiGetTextBufferView(buffer, buffer.lineStarts[line], GuiTextBufferGetLineEnd(&buffer, line) - buffer.lineStarts[line]);
+    }
+
+    return view;
+}
+
+
+//----------------------------------------------------------------------------------
+// Styles loading functions
+//----------------------------------------------------------------------------------
+
+// Load raygui style file (.rgs)
+// NOTE: By default a binary file is expected, that file could contain a custom font,
+// in that case, custom font image atlas is GRAY+ALPHA and pixel data can be compressed (DEFLATE),
+// text style files are detected by the initial comment line
+void GuiLoadStyle(const char *fileName)
+{
+    int fileDataSize = 0;
+    unsigned char *fileData = GuiLoadStyleFile(fileName, &fileDataSize);
+
+    if (fileData == NULL) return;
+
+    // Text style files start with a comment line
+    bool tryBinary = (fileData[0] != '#');
+
+    if (!tryBinary) GuiLoadStyleFromText((const char *)fileData, fileDataSize, fileName);
+
+    if (tryBinary)
+    {
+        GuiStyleData data = { 0 };
+
+        if (GuiLoadStyleData(fileData, fileDataSize, &data))
+        {
+            // Aligned style data is used in place, file data is kept by style set if required
+            if (data.inPlace)
+            {
+                data.fileData = fileData;
+                data.fileDataSize = fileDataSize;
+                fileData = NULL;
+            }
+
+            GuiApplyStyleData(&data);
+        }
+    }
+
+    GuiUnloadStyleFile(fileData, fileDataSize);
+}
+
+// Export current style to binary file (.rgs)
+// NOTE: Aligned binary style (version 500) is not compressed, properties, font recs and font atlas image
+// can be used in place when loaded (memory mapped), control properties equal to DEFAULT are not exported
+bool GuiExportStyle(const char *fileName)
+{
+    int dataSize = 0;
+    unsigned char *data = GuiExportStyleData(&dataSize);
+
+    FILE *rgsFile = fopen(fileName, "wb");
+    bool success = false;
+
+    if (rgsFile != NULL)
+    {
+        success = ((int)fwrite(data, 1, dataSize, rgsFile) == dataSize);
+        fclose(rgsFile);
+    }
+
+    RAYGUI_FREE(data);
+
+    return success;
+}
+
+// Load style bundle file (.rgsb), styles are loaded on request with GuiLoadStyleFromBundle()
+// NOTE: Only bundle header and index are read, bundle file is memory mapped if supported,
+// previous style bundle is unloaded
+bool GuiLoadStyleBundle(const char *fileName)
+{
+    GuiUnloadStyleBundle();
+
+    unsigned char header[16] = { 0 };
+    int bundleSize = 0;
+
+#if defined(RAYGUI_STYLE_MMAP)
+    guiStyleBundle.fileData = GuiLoadStyleFile(fileName, &guiStyleBundle.fileDataSize);
+    bundleSize = guiStyleBundle.fileDataSize;
+
+    if (bundleSize >= 16) memcpy(header, guiStyleBundle.fileData, 16);
+#else
+    FILE *rgsbFile = fopen(fileName, "rb");
+
+    if (rgsbFile != NULL)
+    {
+        fseek(rgsbFile, 0, SEEK_END);
+        bundleSize = ftell(rgsbFile);
+        fseek(rgsbFile, 0, SEEK_SET);
+
+        if (fread(header, 1, 16, rgsbFile) != 16) bundleSize = 0;
+    }
+#endif
+
+    int styleCount = 0;
+    short version = 0;
+    memcpy(&version, header + 4, sizeof(short));
+    memcpy(&styleCount, header + 8, sizeof(int));
+
+    bool valid = ((bundleSize >= 16) && (memcmp(header, "rGSB", 4) == 0) && (version == 100) &&
+                  (styleCount > 0) && (styleCount <= (bundleSize - 16)/(int)sizeof(GuiStyleBundleEntry)));
+
+    if (valid)
+    {
+        guiStyleBundle.entries = (GuiStyleBundleEntry *)RAYGUI_MALLOC(styleCount*sizeof(GuiStyleBundleEntry));
+        guiStyleBundle.entryCount = styleCount;
+
+#if defined(RAYGUI_STYLE_MMAP)
+        memcpy(guiStyleBundle.entries, guiStyleBundle.fileData + 16, styleCount*sizeof(GuiStyleBundleEntry));
+#else
+        valid = ((int)fread(guiStyleBundle.entries, sizeof(GuiStyleBundleEntry), styleCount, rgsbFile) == styleCount);
+#endif
+
+        // Security check, styles data must be aligned and fit in bundle file
+        for (int i = 0; valid && (i < styleCount); i++)
+        {
+            GuiStyleBundleEntry *entry = &guiStyleBundle.entries[i];
+            entry->name[sizeof(entry->name) - 1] = '\0';
+
+            if ((entry->dataOffset < 16) || ((entry->dataOffset%16) != 0) || (entry->compDataSize <= 0) ||
+                (entry->compDataSize > bundleSize - entry->dataOffset) || (entry->dataSize <= 0) ||
+                ((entry->compression == 0) && (entry->compDataSize != entry->dataSize))) valid = false;
+        }
+    }
+
+#if !defined(RAYGUI_STYLE_MMAP)
+    if (rgsbFile != NULL) fclose(rgsbFile);
+    if (valid) strncpy(guiStyleBundle.fileName, fileName, sizeof(guiStyleBundle.fileName) - 1);
+#endif
+
+    if (!valid)
+    {
+        RAYGUI_LOG("WARNING: Style bundle not valid: %s\n", fileName);
+        GuiUnloadStyleBundle();
+    }
+
+    return valid;
+}
+
+// Unload style bundle
+// NOTE: Styles already loaded from bundle are not affected
+void GuiUnloadStyleBundle(void)
+{
+    GuiUnloadStyleFile(guiStyleBundle.fileData, guiStyleBundle.fileDataSize);
+    RAYGUI_FREE(guiStyleBundle.entries);
+    memset(&guiStyleBundle, 0, sizeof(GuiStyleBundle));
+}
+
+// Load style from style bundle over global style, style name as exported in bundle
+// NOTE: Only the requested style data is read and uncompressed, uncompressed styles
+// are used in place from bundle memory map, font recs are copied
+bool GuiLoadStyleFromBundle(const char *styleName)
+{
+    const GuiStyleBundleEntry *entry = NULL;
+
+    for (int i = 0; i < guiStyleBundle.entryCount; i++)
+    {
+        if (strcmp(guiStyleBundle.entries[i].name, styleName) == 0)
+        {
+            entry = &guiStyleBundle.entries[i];
+            break;
+        }
+    }
+
+    if (entry == NULL)
+    {
+        RAYGUI_LOG("WARNING: Style not found in style bundle: %s\n", styleName);
+        return false;
+    }
+
+    const unsigned char *styleData = NULL;
+    unsigned char *styleBuffer = NULL;  // Style data loaded or uncompressed, freed once applied
+    int styleDataSize = entry->compDataSize;
+
+#if defined(RAYGUI_STYLE_MMAP)
+    styleData = guiStyleBundle.fileData + entry->dataOffset;
+#else
+    FILE *rgsbFile = fopen(guiStyleBundle.fileName, "rb");
+
+    if (rgsbFile != NULL)
+    {
+        styleBuffer = (unsigned char *)RAYGUI_MALLOC(styleDataSize);
+        fseek(rgsbFile, entry->dataOffset, SEEK_SET);
+
+        if ((int)fread(styleBuffer, 1, styleDataSize, rgsbFile) == styleDataSize) styleData = styleBuffer;
+        fclose(rgsbFile);
+    }
+#endif
+
+    if ((styleData != NULL) && (entry->compression == 1))
+    {
+        // Compressed style data (DEFLATE), it requires DecompressData()
+        int dataUncompSize = 0;
+        unsigned char *dataUncomp = DecompressData(styleData, entry->compDataSize, &dataUncompSize);
+
+        RAYGUI_FREE(styleBuffer);
+        styleBuffer = dataUncomp;
+        styleData = dataUncomp;
+        styleDataSize = dataUncompSize;
+
+        // Security check, uncompressed size must match the provided data size
+        if (dataUncompSize != entry->dataSize) styleData = NULL;
+    }
+    else if (entry->compression > 1) styleData = NULL;
+
+    bool success = ((styleData != NULL) && (styleDataSize >= 16));
+
+    if (success) GuiLoadStyleFromMemory(styleData, styleDataSize);
+    else RAYGUI_LOG("WARNING: Style bundle data could be corrupted, style not loaded: %s\n", styleName);
+
+    RAYGUI_FREE(styleBuffer);
+
+    return success;
+}
+
+// Export styles to style bundle file (.rgsb), styles loaded from style files (.rgs)
+// NOTE: Styles are stored as aligned binary styles (version 500), text styles fonts are included,
+// uncompressed styles are used in place when loaded, compressed styles (DEFLATE) require CompressData()
+//
+// Style bundle file structure:
+//   Header (16 bytes): char signature[4] "rGSB", short version (100), short reserved, int styleCount, int reserved
+//   Index (48 bytes per style): char name[32], int dataOffset, int dataSize, int compDataSize, int compression (0-None, 1-DEFLATE)
+//   Styles data: aligned binary styles (.rgs version 500), padded to 16 bytes
+bool GuiExportStyleBundle(const char *fileName, const char **styleFileNames, const char **styleNames, int count, bool compress)
+{
+    if (count <= 0) return false;
+
+    static const unsigned char padding[16] = { 0 };
+
+    GuiStyleBundleEntry *entries = (GuiStyleBundleEntry *)RAYGUI_CALLOC(count, sizeof(GuiStyleBundleEntry));
+    unsigned char **stylesData = (unsigned char **)RAYGUI_CALLOC(count, sizeof(unsigned char *));
+    GuiStyleSet *activeSet = guiStyleSet;
+    int dataOffset = 16 + count*(int)sizeof(GuiStyleBundleEntry);
+    bool success = true;
+
+#if defined(RAYGUI_STANDALONE)
+    // NOTE: CompressData() is not available in standalone mode, styles are stored uncompressed
+    if (compress) RAYGUI_LOG("WARNING: Style bundle compression not available, styles stored uncompressed: %s\n", fileName);
+#endif
+
+    for (int i = 0; (i < count) && success; i++)
+    {
+        // Style file is loaded into a temporary style set to be exported
+        FILE *rgsFile = fopen(styleFileNames[i], "rb");
+
+        if (rgsFile == NULL)
+        {
+            RAYGUI_LOG("WARNING: Style file could not be opened: %s\n", styleFileNames[i]);
+            success = false;
+            break;
+        }
+
+        fclose(rgsFile);
+
+        GuiStyleSet *set = GuiLoadStyleSet(styleFileNames[i]);
+        GuiSetStyleSet(set);
+        stylesData[i] = GuiExportStyleData(&entries[i].dataSize);
+        GuiSetStyleSet(activeSet);
+        GuiUnloadStyleSet(set);
+
+        entries[i].compDataSize = entries[i].dataSize;
+
+#if !defined(RAYGUI_STANDALONE)
+        if (compress)
+        {
+            int compDataSize = 0;
+            unsigned char *compData = CompressData(stylesData[i], entries[i].dataSize, &compDataSize);
+
+            // Compressed data is only kept if smaller
+            if ((compData != NULL) && (compDataSize < entries[i].dataSize))
+            {
+                RAYGUI_FREE(stylesData[i]);
+                stylesData[i] = compData;
+                entries[i].compDataSize = compDataSize;
+                entries[i].compression = 1;
+            }
+            else RAYGUI_FREE(compData);
+        }
+#endif
+
+        strncpy(entries[i].name, styleNames[i], sizeof(entries[i].name) - 1);
+        entries[i].dataOffset = dataOffset;
+        dataOffset += ((entries[i].compDataSize + 15)/16)*16;
+    }
+
+    FILE *rgsbFile = success? fopen(fileName, "wb") : NULL;
+
+    if (rgsbFile != NULL)
+    {
+        // Bundle header: signature, version, reserved, styles count, reserved
+        short version = 100;
+        short reserved = 0;
+        int reservedData = 0;
+        fwrite("rGSB", 1, 4, rgsbFile);
+        fwrite(&version, sizeof(short), 1, rgsbFile);
+        fwrite(&reserved, sizeof(short), 1, rgsbFile);
+        fwrite(&count, sizeof(int), 1, rgsbFile);
+        fwrite(&reservedData, sizeof(int), 1, rgsbFile);
+
+        fwrite(entries, sizeof(GuiStyleBundleEntry), count, rgsbFile);
+
+        for (int i = 0; i < count; i++)
+        {
+            fwrite(stylesData[i], 1, entries[i].compDataSize, rgsbFile);
+            fwrite(padding, 1, (16 - entries[i].compDataSize%16)%16, rgsbFile);
+        }
+
+        fclose(rgsbFile);
+    }
+    else success = false;
+
+    for (int i = 0; i < count; i++) RAYGUI_FREE(stylesData[i]);
+    RAYGUI_FREE(stylesData);
+    RAYGUI_FREE(entries);
+
+    return success;
+}
+
+// Export current style as code (.h), resolved style image
+// NOTE: All style properties values are exported, font atlas image is exported uncompressed,
+// loading exported style only requires a values copy and font atlas texture upload
+bool GuiExportStyleAsCode(const char *fileName, const char *styleName)
+{
+    if (!guiStyleSet->loaded) GuiLoadStyleDefault();
+
+    FILE *codeFile = fopen(fileName, "wt");
+
+    if (codeFile == NULL) return false;
+
+    const int propsPerControl = RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED;
+
+    // Style loading function name uses style name with first letter capitalized
+    char functionName[64] = { 0 };
+    strncpy(functionName, styleName, 63);
+    if ((functionName[0] >= 'a') && (functionName[0] <= 'z')) functionName[0] -= 32;
+
+    fprintf(codeFile, "//////////////////////////////////////////////////////////////////////////////////\n");
+    fprintf(codeFile, "//                                                                              //\n");
+    fprintf(codeFile, "// StyleAsCode exporter v3.0 - Style data exported as a resolved style image    //\n");
+    fprintf(codeFile, "//                                                                              //\n");
+    fprintf(codeFile, "%-80s//\n", TextFormat("// USAGE: On init call: GuiLoadStyle%s();", functionName));
+    fprintf(codeFile, "//                                                                              //\n");
+    fprintf(codeFile, "// more info and bugs-report:  github.com/raysan5/raygui                        //\n");
+    fprintf(codeFile, "// feedback and support:       ray[at]raylibtech.com                            //\n");
+    fprintf(codeFile, "//                                                                              //\n");
+    fprintf(codeFile, "//////////////////////////////////////////////////////////////////////////////////\n\n");
+
+    // Style properties values, one line per control: base properties, extended properties
+    fprintf(codeFile, "// Custom style name: %s\n", styleName);
+    fprintf(codeFile, "static const unsigned int %sStyleProps[%i] = {\n", styleName, RAYGUI_MAX_CONTROLS*propsPerControl);
+    for (int i = 0; i < RAYGUI_MAX_CONTROLS; i++)
+    {
+        fprintf(codeFile, "   ");
+        for (int j = 0; j < propsPerControl; j++) fprintf(codeFile, " 0x%08x,", GuiGetStyleValue(i, j));
+        fprintf(codeFile, "    // Control %i\n", i);
+    }
+    fprintf(codeFile, "};\n\n");
+
+    bool fontExported = false;
+
+#if !defined(RAYGUI_STANDALONE)
+    // Export custom font if available, default font is never exported
+    if ((guiFont.texture.id > 0) && (guiFont.texture.id != GetFontDefault().texture.id))
+    {
+        Image imFont = LoadImageFromTexture(guiFont.texture);
+        int imageDataSize = GetPixelDataSize(imFont.width, imFont.height, imFont.format);
+
+        Rectangle whiteRec = { 0 };
+        if (GetShapesTexture().id == guiFont.texture.id) whiteRec = GetShapesTextureRectangle();
+
+        fprintf(codeFile, "// Font atlas image pixels data: uncompressed\n");
+        fprintf(codeFile, "static const unsigned char %sFontAtlas[%i] = {", styleName, imageDataSize);
+        for (int i = 0; i < imageDataSize; i++) fprintf(codeFile, ((i%20) == 0)? "\n    0x%02x," : " 0x%02x,", ((unsigned char *)imFont.data)[i]);
+        fprintf(codeFile, " };\n\n");
+
+        fprintf(codeFile, "// Font glyphs rectangles data (on atlas)\n");
+        fprintf(codeFile, "static const Rectangle %sFontRecs[%i] = {\n", styleName, guiFont.glyphCount);
+        for (int i = 0; i < guiFont.glyphCount; i++) fprintf(codeFile, "    { %i, %i, %i, %i },\n", (int)guiFont.recs[i].x, (int)guiFont.recs[i].y, (int)guiFont.recs[i].width, (int)guiFont.recs[i].height);
+        fprintf(codeFile, "};\n\n");
+
+        fprintf(codeFile, "// Font glyphs info data\n");
+        fprintf(codeFile, "// NOTE: No glyphs.image data provided\n");
+        fprintf(codeFile, "static const GlyphInfo %sFontGlyphs[%i] = {\n", styleName, guiFont.glyphCount);
+        for (int i = 0; i < guiFont.glyphCount; i++) fprintf(codeFile, "    { %i, %i, %i, %i, { 0 }},\n", guiFont.glyphs[i].value, guiFont.glyphs[i].offsetX, guiFont.glyphs[i].offsetY, guiFont.glyphs[i].advanceX);
+        fprintf(codeFile, "};\n\n");
+
+        fprintf(codeFile, "// Style image, resolved properties and font\n");
+        fprintf(codeFile, "static const GuiStyleImage %sStyle = { %sStyleProps, %sFontAtlas, %i, %i, %i, %i, %i, %sFontRecs, %sFontGlyphs, { %i, %i, %i, %i } };\n\n",
+            styleName, styleName, styleName, imFont.width, imFont.height, imFont.format, guiFont.baseSize, guiFont.glyphCount, styleName, styleName,
+            (int)whiteRec.x, (int)whiteRec.y, (int)whiteRec.width, (int)whiteRec.height);
+
+        UnloadImage(imFont);
+        fontExported = true;
+    }
+#endif
+
+    if (!fontExported)
+    {
+        fprintf(codeFile, "// Style image, resolved properties (default font)\n");
+        fprintf(codeFile, "static const GuiStyleImage %sStyle = { %sStyleProps, NULL, 0, 0, 0, 0, 0, NULL, NULL, { 0, 0, 0, 0 } };\n\n", styleName, styleName);
+    }
+
+    fprintf(codeFile, "// Style loading function: %s\n", styleName);
+    fprintf(codeFile, "static void GuiLoadStyle%s(void)\n{\n", functionName);
+    fprintf(codeFile, "    // Load style image: properties values copy and font atlas texture upload\n");
+    fprintf(codeFile, "    GuiLoadStyleImage(&%sStyle);\n}\n", styleName);
+
+    fclose(codeFile);
+
+    return true;
+}
+
+// Load style image over global style (resolved properties and font)
+// NOTE: Font recs and glyphs are copied, font is cached and shared by style sets loading the same image
+void GuiLoadStyleImage(const GuiStyleImage *image)
+{
+    guiStyleSet->loaded = true;
+
+    memcpy(guiStyleSet->props, image->props, sizeof(guiStyleSet->props));
+    GuiUpdateStyleOverrides();
+    GuiResetControlStyles();
+    GuiResetTextCache();
+
+    bool fontLoaded = false;
+
+#if !defined(RAYGUI_STANDALONE)
+    if ((image->fontAtlas != NULL) && (image->fontGlyphCount > 0))
+    {
+        Image imFont = { (void *)image->fontAtlas, image->fontAtlasWidth, image->fontAtlasHeight, 1, image->fontAtlasFormat };
+
+        Font font = { 0 };
+
+        // NOTE: Style image font data is static, font is identified by atlas data address
+        unsigned long long key = GuiHashData(&image->fontAtlas, sizeof(image->fontAtlas), RAYGUI_HASH_SEED);
+
+        if (!GuiGetCachedFont(key, &font))
+        {
+            font.baseSize = image->fontBaseSize;
+            font.glyphCount = image->fontGlyphCount;
+            font.texture = LoadTextureFromImage(imFont);
+
+            if (font.texture.id > 0)
+            {
+                font.recs = (Rectangle *)RAYGUI_MALLOC(font.glyphCount*sizeof(Rectangle));
+                memcpy(font.recs, image->fontRecs, font.glyphCount*sizeof(Rectangle));
+                font.glyphs = (GlyphInfo *)RAYGUI_MALLOC(font.glyphCount*sizeof(GlyphInfo));
+                memcpy(font.glyphs, image->fontGlyphs, font.glyphCount*sizeof(GlyphInfo));
+
+                GuiAddCachedFont(key, font, NULL, 0);
+            }
+        }
+
+        if (font.texture.id > 0)
+        {
+            // Previous style font is released if loaded by a style
+            GuiReleaseFont(guiFont);
+
+            GuiSetFont(font);
+
+            if ((image->fontWhiteRec.width > 0) && (image->fontWhiteRec.height > 0)) SetShapesTexture(font.texture, image->fontWhiteRec);
+
+            fontLoaded = true;
+        }
+    }
+#endif
+
+    // Style image without font uses default font, previous style font is released
+    if (!fontLoaded) GuiLoadFontDefault();
 }
 
 // Load style default over global style
@@ -4120,661 +5555,2284 @@ void GuiLoadStyleDefault(void)
 {
     // We set this variable first to avoid cyclic function calls
     // when calling GuiSetStyle() and GuiGetStyle()
-    guiStyleLoaded = true;
-
-    // Initialize default LIGHT style property values
-    // WARNING: Default value are applied to all controls on set but
-    // they can be overwritten later on for every custom control
-    GuiSetStyle(DEFAULT, BORDER_COLOR_NORMAL, 0x838383ff);
-    GuiSetStyle(DEFAULT, BASE_COLOR_NORMAL, 0xc9c9c9ff);
-    GuiSetStyle(DEFAULT, TEXT_COLOR_NORMAL, 0x686868ff);
-    GuiSetStyle(DEFAULT, BORDER_COLOR_FOCUSED, 0x5bb2d9ff);
-    GuiSetStyle(DEFAULT, BASE_COLOR_FOCUSED, 0xc9effeff);
-    GuiSetStyle(DEFAULT, TEXT_COLOR_FOCUSED, 0x6c9bbcff);
-    GuiSetStyle(DEFAULT, BORDER_COLOR_PRESSED, 0x0492c7ff);
-    GuiSetStyle(DEFAULT, BASE_COLOR_PRESSED, 0x97e8ffff);
-    GuiSetStyle(DEFAULT, TEXT_COLOR_PRESSED, 0x368bafff);
-    GuiSetStyle(DEFAULT, BORDER_COLOR_DISABLED, 0xb5c1c2ff);
-    GuiSetStyle(DEFAULT, BASE_COLOR_DISABLED, 0xe6e9e9ff);
-    GuiSetStyle(DEFAULT, TEXT_COLOR_DISABLED, 0xaeb7b8ff);
-    GuiSetStyle(DEFAULT, BORDER_WIDTH, 1);
-    GuiSetStyle(DEFAULT, TEXT_PADDING, 0);
-    GuiSetStyle(DEFAULT, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
-
-    // Initialize default extended property values
-    // NOTE: By default, extended property values are initialized to 0
-    GuiSetStyle(DEFAULT, TEXT_SIZE, 10);                // DEFAULT, shared by all controls
-    GuiSetStyle(DEFAULT, TEXT_SPACING, 1);              // DEFAULT, shared by all controls
-    GuiSetStyle(DEFAULT, LINE_COLOR, 0x90abb5ff);       // DEFAULT specific property
-    GuiSetStyle(DEFAULT, BACKGROUND_COLOR, 0xf5f5f5ff); // DEFAULT specific property
-    GuiSetStyle(DEFAULT, TEXT_LINE_SPACING, 15);        // DEFAULT, 15 pixels between lines
-    GuiSetStyle(DEFAULT, TEXT_ALIGNMENT_VERTICAL, TEXT_ALIGN_MIDDLE);   // DEFAULT, text aligned vertically to middle of text-bounds
-
-    // Initialize control-specific property values
-    // NOTE: Those properties are in default list but require specific values by control type
-    GuiSetStyle(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
-    GuiSetStyle(BUTTON, BORDER_WIDTH, 2);
-    GuiSetStyle(SLIDER, TEXT_PADDING, 4);
-    GuiSetStyle(PROGRESSBAR, TEXT_PADDING, 4);
-    GuiSetStyle(CHECKBOX, TEXT_PADDING, 4);
-    GuiSetStyle(CHECKBOX, TEXT_ALIGNMENT, TEXT_ALIGN_RIGHT);
-    GuiSetStyle(DROPDOWNBOX, TEXT_PADDING, 0);
-    GuiSetStyle(DROPDOWNBOX, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
-    GuiSetStyle(TEXTBOX, TEXT_PADDING, 4);
-    GuiSetStyle(TEXTBOX, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
-    GuiSetStyle(VALUEBOX, TEXT_PADDING, 0);
-    GuiSetStyle(VALUEBOX, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
-    GuiSetStyle(SPINNER, TEXT_PADDING, 0);
-    GuiSetStyle(SPINNER, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
-    GuiSetStyle(STATUSBAR, TEXT_PADDING, 8);
-    GuiSetStyle(STATUSBAR, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
-
-    // Initialize extended property values
-    // NOTE: By default, extended property values are initialized to 0
-    GuiSetStyle(TOGGLE, GROUP_PADDING, 2);
-    GuiSetStyle(SLIDER, SLIDER_WIDTH, 16);
-    GuiSetStyle(SLIDER, SLIDER_PADDING, 1);
-    GuiSetStyle(PROGRESSBAR, PROGRESS_PADDING, 1);
-    GuiSetStyle(CHECKBOX, CHECK_PADDING, 1);
-    GuiSetStyle(COMBOBOX, COMBO_BUTTON_WIDTH, 32);
-    GuiSetStyle(COMBOBOX, COMBO_BUTTON_SPACING, 2);
-    GuiSetStyle(DROPDOWNBOX, ARROW_PADDING, 16);
-    GuiSetStyle(DROPDOWNBOX, DROPDOWN_ITEMS_SPACING, 2);
-    GuiSetStyle(SPINNER, SPIN_BUTTON_WIDTH, 24);
-    GuiSetStyle(SPINNER, SPIN_BUTTON_SPACING, 2);
-    GuiSetStyle(SCROLLBAR, BORDER_WIDTH, 0);
-    GuiSetStyle(SCROLLBAR, ARROWS_VISIBLE, 0);
-    GuiSetStyle(SCROLLBAR, ARROWS_SIZE, 6);
-    GuiSetStyle(SCROLLBAR, SCROLL_SLIDER_PADDING, 0);
-    GuiSetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE, 16);
-    GuiSetStyle(SCROLLBAR, SCROLL_PADDING, 0);
-    GuiSetStyle(SCROLLBAR, SCROLL_SPEED, 12);
-    GuiSetStyle(LISTVIEW, LIST_ITEMS_HEIGHT, 28);
-    GuiSetStyle(LISTVIEW, LIST_ITEMS_SPACING, 2);
-    GuiSetStyle(LISTVIEW, SCROLLBAR_WIDTH, 12);
-    GuiSetStyle(LISTVIEW, SCROLLBAR_SIDE, SCROLLBAR_RIGHT_SIDE);
-    GuiSetStyle(COLORPICKER, COLOR_SELECTOR_SIZE, 8);
-    GuiSetStyle(COLORPICKER, HUEBAR_WIDTH, 16);
-    GuiSetStyle(COLORPICKER, HUEBAR_PADDING, 8);
-    GuiSetStyle(COLORPICKER, HUEBAR_SELECTOR_HEIGHT, 8);
-    GuiSetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW, 2);
-
-    if (guiFont.texture.id != GetFontDefault().texture.id)
-    {
-        // Unload previous font texture
-        UnloadTexture(guiFont.texture);
-        RL_FREE(guiFont.recs);
-        RL_FREE(guiFont.glyphs);
-        guiFont.recs = NULL;
-        guiFont.glyphs = NULL;
-
-        // Setup default raylib font
-        guiFont = GetFontDefault();
-
-        // NOTE: Default raylib font character 95 is a white square
-        Rectangle whiteChar = guiFont.recs[95];
-
-        // NOTE: We set up a 1px padding on char rectangle to avoid pixel bleeding on MSAA filtering
-        SetShapesTexture(guiFont.texture, RAYGUI_CLITERAL(Rectangle){ whiteChar.x + 1, whiteChar.y + 1, whiteChar.width - 2, whiteChar.height - 2 });
+    guiStyleSet->loaded = true;
+
+    // Default style properties are a static table, loading default style is a values copy
+    // NOTE: All properties are reset, properties not defined by default style are zero
+    memcpy(guiStyleSet->props, guiStyleDefaultProps, sizeof(guiStyleDefaultProps));
+    memcpy(guiStyleSet->overrides, guiStyleDefaultOverrides, sizeof(guiStyleDefaultOverrides));
+    GuiResetControlStyles();
+    GuiResetTextCache();
+
+    GuiLoadFontDefault();
+}
+
+// Unload style, default style loaded
+// NOTE: Style font is released, fonts loaded by styles not referenced anymore are unloaded
+void GuiUnloadStyle(void)
+{
+    GuiLoadStyleDefault();
+
+    for (int i = 0; i < RAYGUI_FONT_CACHE_SIZE; i++)
+    {
+        if ((guiFontCache[i].font.texture.id > 0) && (guiFontCache[i].refCount <= 0))
+        {
+            GuiUnloadFontData(guiFontCache[i].font);
+            GuiUnloadStyleFile(guiFontCache[i].fileData, guiFontCache[i].fileDataSize);
+            memset(&guiFontCache[i], 0, sizeof(GuiFontCacheEntry));
+        }
     }
 }
 
-// Get text with icon id prepended
-// NOTE: Useful to add icons by name id (enum) instead of
-// a number that can change between ricon versions
-const char *GuiIconText(int iconId, const char *text)
+// Load style set from file (.rgs), default style if fileName is NULL
+// NOTE: Style is loaded over default style, same as GuiLoadStyleDefault() + GuiLoadStyle(),
+// style sets defined as code can be loaded activating a new style set before calling GuiLoadStyleXxx()
+GuiStyleSet *GuiLoadStyleSet(const char *fileName)
 {
-#if defined(RAYGUI_NO_ICONS)
-    return NULL;
-#else
-    static char buffer[1024] = { 0 };
-    static char iconBuffer[16] = { 0 };
+    GuiStyleSet *set = (GuiStyleSet *)RAYGUI_CALLOC(1, sizeof(GuiStyleSet));
+    GuiStyleSet *activeSet = guiStyleSet;
 
-    if (text != NULL)
+    // Style is loaded on the new style set as active set,
+    // font and shapes rectangle are kept by style set when active set is restored
+    GuiSetStyleSet(set);
+    GuiLoadStyleDefault();
+    if (fileName != NULL) GuiLoadStyle(fileName);
+    GuiSetStyleSet(activeSet);
+
+    return set;
+}
+
+// Unload style set (including its custom font)
+// NOTE: If style set is active, default style set is activated
+void GuiUnloadStyleSet(GuiStyleSet *set)
+{
+    if ((set == NULL) || (set == &guiStyleSetDefault)) return;
+
+    if (set == guiStyleSet) GuiSetStyleSet(NULL);
+
+    if ((set->font.texture.id > 0) && (set->font.texture.id != GetFontDefault().texture.id))
+    {
+        if (!GuiReleaseFont(set->font)) GuiUnloadFontData(set->font);
+    }
+
+    RAYGUI_FREE(set);
+}
+
+// Set active style set, default style set if NULL
+// NOTE: Style set properties, font and shapes rectangle are activated, no style data is reloaded
+void GuiSetStyleSet(GuiStyleSet *set)
+{
+    if (set == NULL) set = &guiStyleSetDefault;
+    if (set == guiStyleSet) return;
+
+#if defined(RAYGUI_COMMAND_LIST)
+    // NOTE: Recorded commands are drawn using current gui font and shapes texture,
+    // so they must be submitted before the style set is changed
+    GuiFlush();
+#endif
+
+    // Keep current style set font and shapes rectangle, they could be set externally
+    // NOTE: Style set is only considered if it has been loaded
+    if (guiStyleSet->loaded)
+    {
+        guiStyleSet->font = guiFont;
+        guiStyleSet->shapesTexture = GetShapesTexture();
+        guiStyleSet->shapesRec = GetShapesTextureRectangle();
+    }
+
+    guiStyleSet = set;
+    guiFont = set->font;
+    if (set->shapesTexture.id > 0) SetShapesTexture(set->shapesTexture, set->shapesRec);
+
+    // Resolved styles and text box index depend on active style
+    GuiSelectGlyphTable();
+    GuiResetControlStyles();
+    guiTextBoxIndex.text = NULL;
+}
+
+// Get active style set
+GuiStyleSet *GuiGetStyleSet(void)
+{
+    return guiStyleSet;
+}
+
+// Interpolate style sets into active style set
+// NOTE: Color properties are blended channel by channel, non-color properties are copied
+// from one style set or the other at the midpoint, style sets fonts are not interpolated
+// WARNING: Style sets must be loaded, active style set is not modified otherwise
+void GuiStyleLerp(const GuiStyleSet *from, const GuiStyleSet *to, float t)
+{
+    // NOTE: Active style set is loaded on first use, it could be one of the interpolated style sets
+    if (!guiStyleSet->loaded) GuiLoadStyleDefault();
+
+    if ((from == NULL) || (to == NULL) || !from->loaded || !to->loaded)
+    {
+        RAYGUI_LOG("WARNING: Style sets not loaded, styles could not be interpolated\n");
+        return;
+    }
+
+    const int propsPerControl = RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED;
+
+    // NOTE: Active style set could be one of the interpolated style sets,
+    // interpolated values are not written until all values are computed
+    unsigned int props[RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)];
+    unsigned int overrides[RAYGUI_MAX_PROPS_BASE];
+
+    if (t < 0.0f) t = 0.0f;
+    else if (t > 1.0f) t = 1.0f;
+
+    unsigned int factor = (unsigned int)(t*256.0f + 0.5f);     // Fixed point interpolation factor [0..256]
+    const GuiStyleSet *nearest = (t < 0.5f)? from : to;
+
+    for (int i = 0; i < RAYGUI_MAX_CONTROLS; i++)
+    {
+        int offset = i*propsPerControl;
+
+        // Base color properties (BORDER_COLOR_NORMAL..TEXT_COLOR_DISABLED), contiguous values
+        for (int j = 0; j < 12; j++) props[offset + j] = GuiLerpStyleColor(from->props[offset + j], to->props[offset + j], factor);
+
+        // Non-color properties
+        memcpy(props + offset + 12, nearest->props + offset + 12, (propsPerControl - 12)*sizeof(unsigned int));
+    }
+
+    // Controls overriding a base property on any style set get an interpolated value, others inherit DEFAULT
+    // NOTE: If only one style set overrides the property, the other style set DEFAULT value is used
+    for (int j = 0; j < RAYGUI_MAX_PROPS_BASE; j++)
+    {
+        overrides[j] = from->overrides[j] | to->overrides[j];
+
+        unsigned int partial = from->overrides[j] ^ to->overrides[j];
+
+        for (int i = 1; (i < RAYGUI_MAX_CONTROLS) && (partial != 0); i++)
+        {
+            if ((partial & (1u << i)) == 0) continue;
+
+            unsigned int fromValue = (from->overrides[j] & (1u << i))? from->props[i*propsPerControl + j] : from->props[j];
+            unsigned int toValue = (to->overrides[j] & (1u << i))? to->props[i*propsPerControl + j] : to->props[j];
+
+            if (j < 12) props[i*propsPerControl + j] = GuiLerpStyleColor(fromValue, toValue, factor);
+            else props[i*propsPerControl + j] = (nearest == from)? fromValue : toValue;
+
+            partial &= ~(1u << i);
+        }
+    }
+
+    // DEFAULT extended color properties
+    props[LINE_COLOR] = GuiLerpStyleColor(from->props[LINE_COLOR], to->props[LINE_COLOR], factor);
+    props[BACKGROUND_COLOR] = GuiLerpStyleColor(from->props[BACKGROUND_COLOR], to->props[BACKGROUND_COLOR], factor);
+
+    bool textChanged = !guiStyleSet->loaded ||
+        (guiStyleSet->props[TEXT_SIZE] != props[TEXT_SIZE]) ||
+        (guiStyleSet->props[TEXT_SPACING] != props[TEXT_SPACING]);
+
+    memcpy(guiStyleSet->props, props, sizeof(props));
+    memcpy(guiStyleSet->overrides, overrides, sizeof(overrides));
+    guiStyleSet->loaded = true;
+
+    GuiResetControlStyles();
+    if (textChanged) GuiResetTextCache();
+}
+
+#if !defined(RAYGUI_STYLE_ASYNC_NO_THREADS)
+// Style loader worker thread entry point
+#if defined(_WIN32)
+static unsigned int __stdcall GuiStyleLoaderThread(void *parameter) { (void)parameter; GuiLoadStyleAsyncData(); return 0; }
+#else
+static void *GuiStyleLoaderThread(void *parameter) { (void)parameter; GuiLoadStyleAsyncData(); return NULL; }
+#endif
+#endif
+
+// Load style set in background (.rgs)
+// NOTE: File reading and font data decompression are done on a worker thread,
+// font texture upload and style set activation are done by GuiUpdateStyleAsync()
+// WARNING: Text style files (.rgs) are parsed by GuiUpdateStyleAsync(), they could require loading a font file
+bool GuiLoadStyleAsync(const char *fileName, void (*callback)(GuiStyleSet *set))
+{
+    if ((fileName == NULL) || (strlen(fileName) >= sizeof(guiStyleLoader.fileName))) return false;
+
+    if (RAYGUI_ATOMIC_LOAD(&guiStyleLoader.state) != GUI_STYLE_LOADER_IDLE)
+    {
+        RAYGUI_LOG("WARNING: Style loading already in progress, %s not loaded\n", fileName);
+        return false;
+    }
+
+    strcpy(guiStyleLoader.fileName, fileName);
+    guiStyleLoader.callback = callback;
+    guiStyleLoader.textStyle = false;
+    memset(&guiStyleLoader.data, 0, sizeof(GuiStyleData));
+    RAYGUI_ATOMIC_STORE(&guiStyleLoader.state, GUI_STYLE_LOADER_LOADING);
+
+    bool threadStarted = false;
+
+#if !defined(RAYGUI_STYLE_ASYNC_NO_THREADS)
+    #if defined(_WIN32)
+    uintptr_t thread = _beginthreadex(NULL, 0, GuiStyleLoaderThread, NULL, 0, NULL);
+    if (thread != 0)
+    {
+        CloseHandle((void *)thread);
+        threadStarted = true;
+    }
+    #else
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, GuiStyleLoaderThread, NULL) == 0)
+    {
+        pthread_detach(thread);
+        threadStarted = true;
+    }
+    #endif
+#endif
+
+    // Style data is loaded on calling thread if worker thread is not available
+    if (!threadStarted) GuiLoadStyleAsyncData();
+
+    return true;
+}
+
+// Update background style loading
+// NOTE: Once style data is loaded, font texture is uploaded and a new style set is activated,
+// style set is returned and provided to the callback, NULL is returned while loading
+// WARNING: If style could not be loaded, active style set is kept and callback is called with NULL
+GuiStyleSet *GuiUpdateStyleAsync(void)
+{
+    int state = RAYGUI_ATOMIC_LOAD(&guiStyleLoader.state);
+
+    if ((state != GUI_STYLE_LOADER_LOADED) && (state != GUI_STYLE_LOADER_FAILED)) return NULL;
+
+    GuiStyleSet *set = NULL;
+
+    if (state == GUI_STYLE_LOADER_LOADED)
+    {
+        set = GuiLoadStyleSet(NULL);
+
+        GuiSetStyleSet(set);
+
+        if (guiStyleLoader.textStyle)
+        {
+            GuiLoadStyleFromText((const char *)guiStyleLoader.data.fileData, guiStyleLoader.data.fileDataSize, guiStyleLoader.fileName);
+            GuiUnloadStyleData(&guiStyleLoader.data);
+        }
+        else GuiApplyStyleData(&guiStyleLoader.data);
+    }
+    else
+    {
+        // Partially loaded style data is released, active style set is not changed
+        GuiUnloadStyleData(&guiStyleLoader.data);
+        RAYGUI_LOG("WARNING: Style not loaded, active style set kept: %s\n", guiStyleLoader.fileName);
+    }
+
+    RAYGUI_ATOMIC_STORE(&guiStyleLoader.state, GUI_STYLE_LOADER_IDLE);
+
+    if (guiStyleLoader.callback != NULL) guiStyleLoader.callback(set);
+
+    return set;
+}
+
+// Get text with icon id prepended
+// NOTE: Useful to add icons by name id (enum) instead of
+// a number that can change between ricon versions
+const char *GuiIconText(int iconId, const char *text)
+{
+#if defined(RAYGUI_NO_ICONS)
+    return NULL;
+#else
+    static char buffer[1024] = { 0 };
+    static char iconBuffer[16] = { 0 };
+
+    if (text != NULL)
+    {
+        memset(buffer, 0, 1024);
+        sprintf(buffer, "#%03i#", iconId);
+
+        for (int i = 5; i < 1024; i++)
+        {
+            buffer[i] = text[i - 5];
+            if (text[i - 5] == '\0') break;
+        }
+
+        return buffer;
+    }
+    else
+    {
+        sprintf(iconBuffer, "#%03i#", iconId);
+
+        return iconBuffer;
+    }
+#endif
+}
+
+#if !defined(RAYGUI_NO_ICONS)
+// Get full icons data pointer
+// NOTE: Icons data could be modified through returned pointer, so icons atlas (if used) is regenerated
+unsigned int *GuiGetIcons(void)
+{
+#if defined(RAYGUI_ICON_ATLAS)
+    guiIconsAtlasDirty = true;
+#endif
+    return guiIconsPtr;
+}
+
+// Load raygui icons file (.rgi)
+// NOTE: In case nameIds are required, they can be requested with loadIconsName,
+// they are returned as a guiIconsName[iconCount][RAYGUI_ICON_MAX_NAME_LENGTH],
+// WARNING: guiIconsName[]][] memory should be manually freed!
+char **GuiLoadIcons(const char *fileName, bool loadIconsName)
+{
+    // Style File Structure (.rgi)
+    // ------------------------------------------------------
+    // Offset  | Size    | Type       | Description
+    // ------------------------------------------------------
+    // 0       | 4       | char       | Signature: "rGI "
+    // 4       | 2       | short      | Version: 100
+    // 6       | 2       | short      | reserved
+
+    // 8       | 2       | short      | Num icons (N)
+    // 10      | 2       | short      | Icons size (Options: 16, 32, 64) (S)
+
+    // Icons name id (32 bytes per name id)
+    // foreach (icon)
+    // {
+    //   12+32*i  | 32   | char       | Icon NameId
+    // }
+
+    // Icons data: One bit per pixel, stored as unsigned int array (depends on icon size)
+    // S*S pixels/32bit per unsigned int = K unsigned int per icon
+    // foreach (icon)
+    // {
+    //   ...   | K       | unsigned int | Icon Data
+    // }
+
+#if defined(RAYGUI_COMMAND_LIST)
+    guiDamageFull = true;       // Icons drawn with previous data, not tracked by draw items
+#endif
+
+    FILE *rgiFile = fopen(fileName, "rb");
+
+    char **guiIconsName = NULL;
+
+    if (rgiFile != NULL)
+    {
+        char signature[5] = { 0 };
+        short version = 0;
+        short reserved = 0;
+        short iconCount = 0;
+        short iconSize = 0;
+
+        fread(signature, 1, 4, rgiFile);
+        fread(&version, sizeof(short), 1, rgiFile);
+        fread(&reserved, sizeof(short), 1, rgiFile);
+        fread(&iconCount, sizeof(short), 1, rgiFile);
+        fread(&iconSize, sizeof(short), 1, rgiFile);
+
+        if ((signature[0] == 'r') &&
+            (signature[1] == 'G') &&
+            (signature[2] == 'I') &&
+            (signature[3] == ' '))
+        {
+            if (loadIconsName)
+            {
+                guiIconsName = (char **)RAYGUI_MALLOC(iconCount*sizeof(char **));
+                for (int i = 0; i < iconCount; i++)
+                {
+                    guiIconsName[i] = (char *)RAYGUI_MALLOC(RAYGUI_ICON_MAX_NAME_LENGTH);
+                    fread(guiIconsName[i], 1, RAYGUI_ICON_MAX_NAME_LENGTH, rgiFile);
+                }
+            }
+            else fseek(rgiFile, iconCount*RAYGUI_ICON_MAX_NAME_LENGTH, SEEK_CUR);
+
+            // Read icons data directly over internal icons array
+            fread(guiIconsPtr, sizeof(unsigned int), iconCount*(iconSize*iconSize/32), rgiFile);
+
+        #if defined(RAYGUI_ICON_ATLAS)
+            guiIconsAtlasDirty = true;
+        #endif
+        }
+
+        fclose(rgiFile);
+    }
+
+    return guiIconsName;
+}
+
+// Draw selected icon
+void GuiDrawIcon(int iconId, int posX, int posY, int pixelSize, Color color)
+{
+    GuiDrawIconColor(iconId, posX, posY, pixelSize, GuiFade(color, guiAlpha));
+}
+
+// Gui draw icon
+// NOTE: Color is expected to already include global alpha,
+// icon is recorded as a single command if draw commands list is enabled
+static void GuiDrawIconColor(int iconId, int posX, int posY, int pixelSize, Color color)
+{
+#if defined(RAYGUI_COMMAND_LIST)
+    GuiDrawCommand command = { 0 };
+    command.type = GUI_COMMAND_ICON;
+    command.value = iconId;
+    command.size = (float)pixelSize;
+    command.rec = RAYGUI_CLITERAL(Rectangle){ (float)posX, (float)posY, (float)RAYGUI_ICON_SIZE*pixelSize, (float)RAYGUI_ICON_SIZE*pixelSize };
+    command.colors[0] = color;
+    GuiAddDrawCommand(command);
+#elif defined(RAYGUI_ICON_ATLAS)
+    GuiDrawIconAtlas(iconId, posX, posY, pixelSize, color);
+#else
+    GuiDrawIconPixels(iconId, posX, posY, pixelSize, color);
+#endif
+}
+
+// Set icon drawing size
+void GuiSetIconScale(int scale)
+{
+    if (scale >= 1) guiIconScale = scale;
+}
+
+#endif      // !RAYGUI_NO_ICONS
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+#if !defined(RAYGUI_NO_ICONS)
+// Draw selected icon using rectangles pixel-by-pixel
+// NOTE: Color is expected to already include global alpha
+static void GuiDrawIconPixels(int iconId, int posX, int posY, int pixelSize, Color color)
+{
+    #define BIT_CHECK(a,b) ((a) & (1u<<(b)))
+
+    for (int i = 0, y = 0; i < RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE/32; i++)
+    {
+        for (int k = 0; k < 32; k++)
+        {
+            if (BIT_CHECK(guiIconsPtr[iconId*RAYGUI_ICON_DATA_ELEMENTS + i], k))
+            {
+                DrawRectangle(posX + (k%RAYGUI_ICON_SIZE)*pixelSize, posY + y*pixelSize, pixelSize, pixelSize, color);
+            }
+
+            if ((k == 15) || (k == 31)) y++;
+        }
+    }
+}
+
+#if defined(RAYGUI_ICON_ATLAS)
+// Draw selected icon as a single quad from icons atlas
+// NOTE: Color is expected to already include global alpha
+static void GuiDrawIconAtlas(int iconId, int posX, int posY, int pixelSize, Color color)
+{
+    if (guiIconsAtlasDirty) GuiLoadIconsAtlas();
+
+    Rectangle source = { (float)((iconId%RAYGUI_ICONS_ATLAS_COLUMNS)*RAYGUI_ICON_SIZE), (float)((iconId/RAYGUI_ICONS_ATLAS_COLUMNS)*RAYGUI_ICON_SIZE), (float)RAYGUI_ICON_SIZE, (float)RAYGUI_ICON_SIZE };
+    Rectangle dest = { (float)posX, (float)posY, (float)RAYGUI_ICON_SIZE*pixelSize, (float)RAYGUI_ICON_SIZE*pixelSize };
+
+    DrawTexturePro(guiIconsAtlas, source, dest, RAYGUI_CLITERAL(Vector2){ 0, 0 }, 0.0f, color);
+}
+
+// Generate icons atlas texture from current icons data
+// NOTE: Atlas uses white pixels with alpha, icons are tinted on drawing,
+// atlas texture requires point filtering (default) to keep icons pixel-perfect
+static void GuiLoadIconsAtlas(void)
+{
+    if (guiIconsAtlas.id > 0) UnloadTexture(guiIconsAtlas);
+
+    Image atlas = { 0 };
+    atlas.width = RAYGUI_ICONS_ATLAS_COLUMNS*RAYGUI_ICON_SIZE;
+    atlas.height = ((RAYGUI_ICON_MAX_ICONS + RAYGUI_ICONS_ATLAS_COLUMNS - 1)/RAYGUI_ICONS_ATLAS_COLUMNS)*RAYGUI_ICON_SIZE;
+    atlas.mipmaps = 1;
+    atlas.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+    atlas.data = RAYGUI_CALLOC(atlas.width*atlas.height*2, 1);
+
+    unsigned char *pixels = (unsigned char *)atlas.data;
+
+    for (int iconId = 0; iconId < RAYGUI_ICON_MAX_ICONS; iconId++)
+    {
+        int offsetX = (iconId%RAYGUI_ICONS_ATLAS_COLUMNS)*RAYGUI_ICON_SIZE;
+        int offsetY = (iconId/RAYGUI_ICONS_ATLAS_COLUMNS)*RAYGUI_ICON_SIZE;
+
+        for (int i = 0; i < RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE; i++)
+        {
+            if (BIT_CHECK(guiIconsPtr[iconId*RAYGUI_ICON_DATA_ELEMENTS + i/32], i%32))
+            {
+                int index = ((offsetY + i/RAYGUI_ICON_SIZE)*atlas.width + offsetX + i%RAYGUI_ICON_SIZE)*2;
+                pixels[index] = 255;        // Gray
+                pixels[index + 1] = 255;    // Alpha
+            }
+        }
+    }
+
+    guiIconsAtlas = LoadTextureFromImage(atlas);
+    RAYGUI_FREE(atlas.data);
+
+    guiIconsAtlasDirty = false;
+}
+#endif
+#endif
+
+// Load style from memory
+// WARNING: Binary files only
+static void GuiLoadStyleFromMemory(const unsigned char *fileData, int dataSize)
+{
+    GuiStyleData data = { 0 };
+
+    if (GuiLoadStyleData(fileData, dataSize, &data)) GuiApplyStyleData(&data);
+}
+
+// Load style from text data (.txt.rgs)
+// NOTE: Single pass tokenizer, no memory is allocated for parsing, properties are written directly
+// and controls overrides are updated once at the end, DEFAULT base properties are inherited
+// by controls not defining them, independently of their order in the file,
+// malformed entries are skipped and reported with line and column
+//
+// Text style entries, one per line:
+//   # <comment>
+//   p <control_id> <property_id> <property_value> <property_name>
+//   f <gen_font_size> <charmap_file> <font_file>
+static void GuiLoadStyleFromText(const char *text, int textSize, const char *fileName)
+{
+    const int propsPerControl = RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED;
+    unsigned int definedProps[RAYGUI_MAX_PROPS_BASE] = { 0 };  // Controls defining base properties, one bit per control
+
+    const char *end = text + textSize;
+    const char *lineStart = text;
+    int line = 1;
+
+    if (!guiStyleSet->loaded) GuiLoadStyleDefault();
+
+    while (lineStart < end)
+    {
+        const char *lineEnd = lineStart;
+        while ((lineEnd < end) && (*lineEnd != '\n')) lineEnd++;
+
+        const char *contentEnd = lineEnd;
+        if ((contentEnd > lineStart) && (contentEnd[-1] == '\r')) contentEnd--;
+
+        const char *ptr = lineStart + 1;
+        const char *errorPtr = NULL;
+        const char *error = NULL;
+
+        switch ((lineStart < contentEnd)? *lineStart : '#')
+        {
+            case '#': break;    // Comment or empty line
+            case 'p':
+            {
+                // Style property: p <control_id> <property_id> <property_value> <property_name>
+                unsigned int controlId = 0;
+                unsigned int propertyId = 0;
+                unsigned int propertyValue = 0;
+
+                if ((errorPtr = ptr, ptr = GuiParseStyleValue(ptr, contentEnd, &controlId)) == NULL) error = "control id expected";
+                else if ((errorPtr = ptr, ptr = GuiParseStyleValue(ptr, contentEnd, &propertyId)) == NULL) error = "property id expected";
+                else if ((errorPtr = ptr, ptr = GuiParseStyleValue(ptr, contentEnd, &propertyValue)) == NULL) error = "property value expected";
+                else if ((controlId >= RAYGUI_MAX_CONTROLS) || (propertyId >= (unsigned int)propsPerControl))
+                {
+                    errorPtr = lineStart + 1;
+                    error = "property out of range";
+                }
+                else
+                {
+                    guiStyleSet->props[controlId*propsPerControl + propertyId] = propertyValue;
+                    if (propertyId < RAYGUI_MAX_PROPS_BASE) definedProps[propertyId] |= (1u << controlId);
+                }
+            } break;
+            case 'f':
+            {
+                // Style font: f <gen_font_size> <charmap_file> <font_file>
+                unsigned int fontSize = 0;
+                char charmapFileName[256] = { 0 };
+                char fontFileName[256] = { 0 };
+
+                errorPtr = ptr;
+                ptr = GuiParseStyleValue(ptr, contentEnd, &fontSize);
+
+                if (ptr == NULL) error = "font size expected";
+                else
+                {
+                    int length = 0;
+
+                    while ((ptr < contentEnd) && ((*ptr == ' ') || (*ptr == '\t'))) ptr++;
+                    while ((ptr < contentEnd) && (*ptr != ' ') && (*ptr != '\t') && (length < 255)) charmapFileName[length++] = *ptr++;
+                    while ((ptr < contentEnd) && ((*ptr == ' ') || (*ptr == '\t'))) ptr++;
+
+                    errorPtr = ptr;
+                    length = 0;
+                    while ((ptr < contentEnd) && (length < 255)) fontFileName[length++] = *ptr++;
+
+                    if (charmapFileName[0] == '\0') error = "charmap file expected";
+                    else if (ptr < contentEnd) error = "font file name too long";
+                    else GuiLoadStyleFont(fileName, (int)fontSize, charmapFileName, fontFileName);
+                }
+            } break;
+            default:
+            {
+                errorPtr = lineStart;
+                error = "unknown style entry";
+            } break;
+        }
+
+        if (error != NULL)
+        {
+            // Error column points to the start of the token not valid
+            while ((errorPtr < contentEnd) && ((*errorPtr == ' ') || (*errorPtr == '\t'))) errorPtr++;
+            RAYGUI_LOG("WARNING: STYLE: [%s] Line %i, column %i: %s\n", fileName, line, (int)(errorPtr - lineStart) + 1, error);
+        }
+
+        lineStart = lineEnd + 1;
+        line++;
+    }
+
+    // DEFAULT base properties defined reset previous controls overrides
+    for (int j = 0; j < RAYGUI_MAX_PROPS_BASE; j++)
+    {
+        if (definedProps[j] & 1u) guiStyleSet->overrides[j] = definedProps[j] & ~1u;
+        else guiStyleSet->overrides[j] |= definedProps[j];
+    }
+
+    // Properties have been written directly, resolved styles and text metrics are not valid anymore
+    GuiResetControlStyles();
+    GuiResetTextCache();
+}
+
+// Parse text style value token (decimal or hexadecimal with 0x prefix)
+// NOTE: Returns text position after token, NULL if no valid value token is found
+static const char *GuiParseStyleValue(const char *text, const char *end, unsigned int *value)
+{
+    unsigned int result = 0;
+    int digits = 0;
+
+    while ((text < end) && ((*text == ' ') || (*text == '\t'))) text++;
+
+    if (((end - text) > 2) && (text[0] == '0') && ((text[1] == 'x') || (text[1] == 'X')))
+    {
+        for (text += 2; text < end; text++, digits++)
+        {
+            char c = *text;
+
+            if ((c >= '0') && (c <= '9')) result = (result << 4) | (unsigned int)(c - '0');
+            else if ((c >= 'a') && (c <= 'f')) result = (result << 4) | (unsigned int)(c - 'a' + 10);
+            else if ((c >= 'A') && (c <= 'F')) result = (result << 4) | (unsigned int)(c - 'A' + 10);
+            else break;
+        }
+    }
+    else
+    {
+        for (; (text < end) && (*text >= '0') && (*text <= '9'); text++, digits++) result = result*10 + (unsigned int)(*text - '0');
+    }
+
+    // Value token must be followed by a separator
+    if ((digits == 0) || ((text < end) && (*text != ' ') && (*text != '\t'))) return NULL;
+
+    *value = result;
+
+    return text;
+}
+
+// Load style font (text style)
+// NOTE: Font and charmap files are relative to style file directory
+// NOTE: Fonts are cached by font file, size and codepoints, they are not loaded again by other styles
+static void GuiLoadStyleFont(const char *fileName, int fontSize, const char *charmapFileName, const char *fontFileName)
+{
+    Font font = { 0 };
+    int *codepoints = NULL;
+    int codepointCount = 0;
+    bool cached = false;
+
+    if (charmapFileName[0] != '0')
+    {
+        // Load text data from file
+        // NOTE: Expected an UTF-8 array of codepoints, no separation
+        char *textData = LoadFileText(TextFormat("%s/%s", GetDirectoryPath(fileName), charmapFileName));
+
+        if (textData != NULL)
+        {
+            codepoints = LoadCodepoints(textData, &codepointCount);
+            UnloadFileText(textData);
+        }
+    }
+
+    if (fontFileName[0] != '\0')
+    {
+        const char *fontPath = TextFormat("%s/%s", GetDirectoryPath(fileName), fontFileName);
+
+        unsigned long long key = GuiHashData(fontPath, (int)strlen(fontPath), RAYGUI_HASH_SEED);
+        key = GuiHashData(&fontSize, sizeof(int), key);
+        key = GuiHashData(codepoints, codepointCount*sizeof(int), key);
+
+        cached = GuiGetCachedFont(key, &font);
+
+        if (!cached)
+        {
+            if (codepointCount > 0) font = LoadFontEx(fontPath, fontSize, codepoints, codepointCount);
+            else font = LoadFontEx(fontPath, fontSize, NULL, 0);   // Default to 95 standard codepoints
+
+            // NOTE: Default font is returned by LoadFontEx() on failure, it is never cached
+            if ((font.texture.id > 0) && (font.texture.id != GetFontDefault().texture.id)) cached = GuiAddCachedFont(key, font, NULL, 0);
+        }
+    }
+
+    // If font texture not properly loaded, revert to default font and size/spacing
+    if (font.texture.id == 0)
+    {
+        font = GetFontDefault();
+        GuiSetStyle(DEFAULT, TEXT_SIZE, 10);
+        GuiSetStyle(DEFAULT, TEXT_SPACING, 1);
+    }
+
+    UnloadCodepoints(codepoints);
+
+    if ((font.texture.id > 0) && (font.glyphCount > 0))
+    {
+        // Previous style font is released if loaded by a style
+        GuiReleaseFont(guiFont);
+
+        GuiSetFont(font);
+    }
+    else if (cached) GuiReleaseFont(font);
+}
+
+// Load style data for background style loading
+// NOTE: Called from worker thread, only style loader data is accessed
+static void GuiLoadStyleAsyncData(void)
+{
+    int fileDataSize = 0;
+    unsigned char *fileData = GuiLoadStyleFile(guiStyleLoader.fileName, &fileDataSize);
+    bool loaded = false;
+
+    if (fileData != NULL)
+    {
+        // Text style files start with a comment line
+        // NOTE: Text style file data is kept by style data, parsed when applied
+        if (fileData[0] == '#') guiStyleLoader.textStyle = true;
+
+        loaded = guiStyleLoader.textStyle || GuiLoadStyleData(fileData, fileDataSize, &guiStyleLoader.data);
+
+        if (!loaded) RAYGUI_LOG("WARNING: Style file not valid: %s\n", guiStyleLoader.fileName);
+        else if (guiStyleLoader.textStyle || guiStyleLoader.data.inPlace)
+        {
+            // Aligned style data is used in place, file data is owned by style data
+            guiStyleLoader.data.fileData = fileData;
+            guiStyleLoader.data.fileDataSize = fileDataSize;
+            fileData = NULL;
+        }
+
+        GuiUnloadStyleFile(fileData, fileDataSize);
+    }
+    else RAYGUI_LOG("WARNING: Style file could not be opened: %s\n", guiStyleLoader.fileName);
+
+    RAYGUI_ATOMIC_STORE(&guiStyleLoader.state, loaded? GUI_STYLE_LOADER_LOADED : GUI_STYLE_LOADER_FAILED);
+}
+
+// Load style data from memory, style is not applied
+// NOTE: No GPU access or gui global state required, style data can be loaded on any thread
+// WARNING: Binary files only
+static bool GuiLoadStyleData(const unsigned char *fileData, int dataSize, GuiStyleData *data)
+{
+    unsigned char *fileDataPtr = (unsigned char *)fileData;
+
+    char signature[5] = { 0 };
+    short version = 0;
+    short reserved = 0;
+    int propertyCount = 0;
+
+    memcpy(signature, fileDataPtr, 4);
+    memcpy(&version, fileDataPtr + 4, sizeof(short));
+    memcpy(&reserved, fileDataPtr + 4 + 2, sizeof(short));
+    memcpy(&propertyCount, fileDataPtr + 4 + 2 + 2, sizeof(int));
+    fileDataPtr += 12;
+
+    if ((signature[0] != 'r') ||
+        (signature[1] != 'G') ||
+        (signature[2] != 'S') ||
+        (signature[3] != ' ')) return false;
+
+    // Aligned binary style, data is not copied
+    if (version >= 500) return GuiLoadStyleDataAligned(fileData, dataSize, data);
+
+    data->propertyCount = propertyCount;
+    data->props = (GuiStyleProp *)RAYGUI_CALLOC(propertyCount, sizeof(GuiStyleProp));
+
+    for (int i = 0; i < propertyCount; i++)
+    {
+        memcpy(&data->props[i].controlId, fileDataPtr, sizeof(short));
+        memcpy(&data->props[i].propertyId, fileDataPtr + 2, sizeof(short));
+        memcpy(&data->props[i].propertyValue, fileDataPtr + 2 + 2, sizeof(unsigned int));
+        fileDataPtr += 8;
+    }
+
+    // Font loading is highly dependant on raylib API to load font data and image
+
+#if !defined(RAYGUI_STANDALONE)
+    // Load custom font if available
+    int fontDataSize = 0;
+    memcpy(&fontDataSize, fileDataPtr, sizeof(int));
+    fileDataPtr += 4;
+
+    if (fontDataSize > 0)
+    {
+        Font font = { 0 };
+        int fontType = 0;   // 0-Normal, 1-SDF
+
+        memcpy(&font.baseSize, fileDataPtr, sizeof(int));
+        memcpy(&font.glyphCount, fileDataPtr + 4, sizeof(int));
+        memcpy(&fontType, fileDataPtr + 4 + 4, sizeof(int));
+        fileDataPtr += 12;
+
+        // Load font white rectangle
+        Rectangle fontWhiteRec = { 0 };
+        memcpy(&fontWhiteRec, fileDataPtr, sizeof(Rectangle));
+        fileDataPtr += 16;
+
+        // Load font image parameters
+        int fontImageUncompSize = 0;
+        int fontImageCompSize = 0;
+        memcpy(&fontImageUncompSize, fileDataPtr, sizeof(int));
+        memcpy(&fontImageCompSize, fileDataPtr + 4, sizeof(int));
+        fileDataPtr += 8;
+
+        Image imFont = { 0 };
+        imFont.mipmaps = 1;
+        memcpy(&imFont.width, fileDataPtr, sizeof(int));
+        memcpy(&imFont.height, fileDataPtr + 4, sizeof(int));
+        memcpy(&imFont.format, fileDataPtr + 4 + 4, sizeof(int));
+        fileDataPtr += 12;
+
+        if ((fontImageCompSize > 0) && (fontImageCompSize != fontImageUncompSize))
+        {
+            // Compressed font atlas image data (DEFLATE), it requires DecompressData()
+            int dataUncompSize = 0;
+            unsigned char *compData = (unsigned char *)RAYGUI_MALLOC(fontImageCompSize);
+            memcpy(compData, fileDataPtr, fontImageCompSize);
+            fileDataPtr += fontImageCompSize;
+
+            imFont.data = DecompressData(compData, fontImageCompSize, &dataUncompSize);
+
+            // Security check, dataUncompSize must match the provided fontImageUncompSize
+            if (dataUncompSize != fontImageUncompSize) RAYGUI_LOG("WARNING: Uncompressed font atlas image data could be corrupted");
+
+            RAYGUI_FREE(compData);
+        }
+        else
+        {
+            // Font atlas image data is not compressed
+            imFont.data = (unsigned char *)RAYGUI_MALLOC(fontImageUncompSize);
+            memcpy(imFont.data, fileDataPtr, fontImageUncompSize);
+            fileDataPtr += fontImageUncompSize;
+        }
+
+        // Load font recs data
+        int recsDataSize = font.glyphCount*sizeof(Rectangle);
+        int recsDataCompressedSize = 0;
+
+        // WARNING: Version 400 adds the compression size parameter
+        if (version >= 400)
+        {
+            // RGS files version 400 support compressed recs data
+            memcpy(&recsDataCompressedSize, fileDataPtr, sizeof(int));
+            fileDataPtr += sizeof(int);
+        }
+
+        if ((recsDataCompressedSize > 0) && (recsDataCompressedSize != recsDataSize))
+        {
+            // Recs data is compressed, uncompress it
+            unsigned char *recsDataCompressed = (unsigned char *)RAYGUI_MALLOC(recsDataCompressedSize);
+
+            memcpy(recsDataCompressed, fileDataPtr, recsDataCompressedSize);
+            fileDataPtr += recsDataCompressedSize;
+
+            int recsDataUncompSize = 0;
+            font.recs = (Rectangle *)DecompressData(recsDataCompressed, recsDataCompressedSize, &recsDataUncompSize);
+
+            // Security check, data uncompressed size must match the expected original data size
+            if (recsDataUncompSize != recsDataSize) RAYGUI_LOG("WARNING: Uncompressed font recs data could be corrupted");
+
+            RAYGUI_FREE(recsDataCompressed);
+        }
+        else
+        {
+            // Recs data is uncompressed
+            font.recs = (Rectangle *)RAYGUI_CALLOC(font.glyphCount, sizeof(Rectangle));
+            for (int i = 0; i < font.glyphCount; i++)
+            {
+                memcpy(&font.recs[i], fileDataPtr, sizeof(Rectangle));
+                fileDataPtr += sizeof(Rectangle);
+            }
+        }
+
+        // Load font glyphs info data
+        int glyphsDataSize = font.glyphCount*16;    // 16 bytes data per glyph
+        int glyphsDataCompressedSize = 0;
+
+        // WARNING: Version 400 adds the compression size parameter
+        if (version >= 400)
+        {
+            // RGS files version 400 support compressed glyphs data
+            memcpy(&glyphsDataCompressedSize, fileDataPtr, sizeof(int));
+            fileDataPtr += sizeof(int);
+        }
+
+        // Allocate required glyphs space to fill with data
+        font.glyphs = (GlyphInfo *)RAYGUI_CALLOC(font.glyphCount, sizeof(GlyphInfo));
+
+        if ((glyphsDataCompressedSize > 0) && (glyphsDataCompressedSize != glyphsDataSize))
+        {
+            // Glyphs data is compressed, uncompress it
+            unsigned char *glypsDataCompressed = (unsigned char *)RAYGUI_MALLOC(glyphsDataCompressedSize);
+
+            memcpy(glypsDataCompressed, fileDataPtr, glyphsDataCompressedSize);
+            fileDataPtr += glyphsDataCompressedSize;
+
+            int glyphsDataUncompSize = 0;
+            unsigned char *glyphsDataUncomp = DecompressData(glypsDataCompressed, glyphsDataCompressedSize, &glyphsDataUncompSize);
+
+            // Security check, data uncompressed size must match the expected original data size
+            if (glyphsDataUncompSize != glyphsDataSize) RAYGUI_LOG("WARNING: Uncompressed font glyphs data could be corrupted");
+
+            unsigned char *glyphsDataUncompPtr = glyphsDataUncomp;
+
+            for (int i = 0; i < font.glyphCount; i++)
+            {
+                memcpy(&font.glyphs[i].value, glyphsDataUncompPtr, sizeof(int));
+                memcpy(&font.glyphs[i].offsetX, glyphsDataUncompPtr + 4, sizeof(int));
+                memcpy(&font.glyphs[i].offsetY, glyphsDataUncompPtr + 8, sizeof(int));
+                memcpy(&font.glyphs[i].advanceX, glyphsDataUncompPtr + 12, sizeof(int));
+                glyphsDataUncompPtr += 16;
+            }
+
+            RAYGUI_FREE(glypsDataCompressed);
+            RAYGUI_FREE(glyphsDataUncomp);
+        }
+        else
+        {
+            // Glyphs data is uncompressed
+            for (int i = 0; i < font.glyphCount; i++)
+            {
+                memcpy(&font.glyphs[i].value, fileDataPtr, sizeof(int));
+                memcpy(&font.glyphs[i].offsetX, fileDataPtr + 4, sizeof(int));
+                memcpy(&font.glyphs[i].offsetY, fileDataPtr + 8, sizeof(int));
+                memcpy(&font.glyphs[i].advanceX, fileDataPtr + 12, sizeof(int));
+                fileDataPtr += 16;
+            }
+        }
+
+        data->font = font;
+        data->fontImage = imFont;
+        data->fontWhiteRec = fontWhiteRec;
+        data->fontKey = GuiGetStyleFontKey(data, fontImageUncompSize);
+    }
+#endif
+
+    return true;
+}
+
+// Load aligned style data from memory (binary version 500)
+// NOTE: Properties, font recs and font atlas image are used in place, only glyphs info is allocated,
+// file data must be kept while style data is used, file data must be 4-byte aligned (mapped or allocated)
+//
+// Aligned binary style file structure, all sections start at 16-byte aligned offsets:
+//   Header (16 bytes): char signature[4] ("rGS "), short version (500), short reserved, int propertyCount, int fontDataSize
+//   Properties: GuiStyleProp props[propertyCount] (8 bytes each), padded to 16 bytes
+//   Font header (48 bytes): int baseSize, glyphCount, fontType, reserved, Rectangle whiteRec, int imageWidth, imageHeight, imageFormat, imageDataSize
+//   Font recs: Rectangle recs[glyphCount] (16 bytes each)
+//   Font glyphs: int value, offsetX, offsetY, advanceX (16 bytes each)
+//   Font image: unsigned char imageData[imageDataSize], uncompressed, padded to 16 bytes
+static bool GuiLoadStyleDataAligned(const unsigned char *fileData, int dataSize, GuiStyleData *data)
+{
+    int propertyCount = 0;
+    int fontDataSize = 0;
+
+    if (dataSize < 16) return false;
+
+    memcpy(&propertyCount, fileData + 8, sizeof(int));
+    memcpy(&fontDataSize, fileData + 12, sizeof(int));
+
+    if ((propertyCount < 0) || (propertyCount > (dataSize - 16)/8) || (fontDataSize < 0)) return false;
+
+    int fontDataOffset = 16 + ((propertyCount*8 + 15)/16)*16;
+
+    if (fontDataSize > dataSize - fontDataOffset) return false;
+
+    if (((size_t)fileData%4) != 0)
+    {
+        RAYGUI_LOG("WARNING: Aligned style data can not be used in place, data is not aligned\n");
+        return false;
+    }
+
+    data->inPlace = true;
+    data->propertyCount = propertyCount;
+    data->props = (GuiStyleProp *)(fileData + 16);
+
+#if !defined(RAYGUI_STANDALONE)
+    if (fontDataSize >= 48)
+    {
+        const unsigned char *fontData = fileData + fontDataOffset;
+        int imageDataSize = 0;
+
+        memcpy(&data->font.baseSize, fontData, sizeof(int));
+        memcpy(&data->font.glyphCount, fontData + 4, sizeof(int));
+        memcpy(&data->fontWhiteRec, fontData + 16, sizeof(Rectangle));
+        memcpy(&data->fontImage.width, fontData + 32, sizeof(int));
+        memcpy(&data->fontImage.height, fontData + 36, sizeof(int));
+        memcpy(&data->fontImage.format, fontData + 40, sizeof(int));
+        memcpy(&imageDataSize, fontData + 44, sizeof(int));
+
+        int glyphCount = data->font.glyphCount;
+        int width = data->fontImage.width;
+        int height = data->fontImage.height;
+        int format = data->fontImage.format;
+
+        // Security check, font recs, glyphs and image data must fit in font data,
+        // font image must be uncompressed (8 bit per channel) and its pixel data must fit in image data
+        // NOTE: Image size limited to 8192x8192 pixels, so required pixel data size can not overflow
+        bool valid = ((glyphCount > 0) && (glyphCount <= (fontDataSize - 48)/32) &&
+                      (imageDataSize > 0) && (imageDataSize <= fontDataSize - 48 - glyphCount*32) &&
+                      (width > 0) && (width <= 8192) && (height > 0) && (height <= 8192) &&
+                      (format >= PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) && (format <= PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) &&
+                      (imageDataSize >= GetPixelDataSize(width, height, format)));
+
+        if (!valid)
+        {
+            RAYGUI_LOG("WARNING: Aligned style font data could be corrupted, style not loaded\n");
+            memset(data, 0, sizeof(GuiStyleData));
+            return false;
+        }
+
+        data->font.recs = (Rectangle *)(fontData + 48);
+        data->fontImage.data = (void *)(fontData + 48 + glyphCount*32);
+        data->fontImage.mipmaps = 1;
+
+        // NOTE: Glyphs info can not be used in place, GlyphInfo includes glyph image
+        const int *glyphsData = (const int *)(fontData + 48 + glyphCount*16);
+        data->font.glyphs = (GlyphInfo *)RAYGUI_CALLOC(glyphCount, sizeof(GlyphInfo));
+
+        for (int i = 0; i < glyphCount; i++)
+        {
+            data->font.glyphs[i].value = glyphsData[i*4];
+            data->font.glyphs[i].offsetX = glyphsData[i*4 + 1];
+            data->font.glyphs[i].offsetY = glyphsData[i*4 + 2];
+            data->font.glyphs[i].advanceX = glyphsData[i*4 + 3];
+        }
+
+        data->fontKey = GuiGetStyleFontKey(data, imageDataSize);
+    }
+#endif
+
+    return true;
+}
+
+// Apply style data loaded over current style, style data is unloaded
+// NOTE: Font atlas texture is uploaded to GPU, it must be called from the rendering thread
+static void GuiApplyStyleData(GuiStyleData *data)
+{
+    for (int i = 0; i < data->propertyCount; i++)
+    {
+        // If a DEFAULT property is loaded, it is propagated to all controls
+        // NOTE: All DEFAULT properties should be defined first in the file
+        GuiSetStyle((int)data->props[i].controlId, (int)data->props[i].propertyId, data->props[i].propertyValue);
+    }
+
+#if !defined(RAYGUI_STANDALONE)
+    if (data->fontImage.data != NULL)
+    {
+        Font font = { 0 };
+
+        // Font already loaded by another style is shared, style font data is unloaded
+        if (!GuiGetCachedFont(data->fontKey, &font))
+        {
+            font = data->font;
+            font.texture = LoadTextureFromImage(data->fontImage);
+
+            // Validate font atlas texture was loaded correctly
+            if (font.texture.id == 0) font = GetFontDefault();    // Fallback in case of errors loading font atlas texture
+            else
+            {
+                // Style file data is kept by font cache while font recs are used in place
+                if (!data->inPlace) GuiAddCachedFont(data->fontKey, font, NULL, 0);
+                else if ((data->fileData != NULL) && GuiAddCachedFont(data->fontKey, font, data->fileData, data->fileDataSize)) data->fileData = NULL;
+                else
+                {
+                    // Style data memory is not kept, font recs must be copied
+                    font.recs = (Rectangle *)RAYGUI_MALLOC(font.glyphCount*sizeof(Rectangle));
+                    memcpy(font.recs, data->font.recs, font.glyphCount*sizeof(Rectangle));
+
+                    if (data->fileData == NULL) GuiAddCachedFont(data->fontKey, font, NULL, 0);
+                }
+
+                // Font recs and glyphs are now owned by gui font
+                data->font.recs = NULL;
+                data->font.glyphs = NULL;
+            }
+        }
+
+        // Previous style font is released if loaded by a style
+        GuiReleaseFont(guiFont);
+
+        GuiSetFont(font);
+
+        // Set font texture source rectangle to be used as white texture to draw shapes
+        // NOTE: It makes possible to draw shapes and text (full UI) in a single draw call
+        if ((data->fontWhiteRec.x > 0) &&
+            (data->fontWhiteRec.y > 0) &&
+            (data->fontWhiteRec.width > 0) &&
+            (data->fontWhiteRec.height > 0)) SetShapesTexture(font.texture, data->fontWhiteRec);
+    }
+#endif
+
+    GuiUnloadStyleData(data);
+}
+
+// Export current style data, aligned binary style (version 500)
+// NOTE: Returned data must be freed with RAYGUI_FREE()
+static unsigned char *GuiExportStyleData(int *dataSize)
+{
+    if (!guiStyleSet->loaded) GuiLoadStyleDefault();
+
+    const int propsPerControl = RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED;
+
+    // Collect style properties, DEFAULT properties first, they are inherited on loading
+    GuiStyleProp *props = (GuiStyleProp *)RAYGUI_CALLOC(RAYGUI_MAX_CONTROLS*propsPerControl, sizeof(GuiStyleProp));
+    int propertyCount = 0;
+
+    for (int i = 0; i < RAYGUI_MAX_CONTROLS; i++)
+    {
+        for (int j = 0; j < propsPerControl; j++)
+        {
+            unsigned int value = guiStyleSet->props[i*propsPerControl + j];
+
+            // Only control overrides of DEFAULT base properties are exported
+            if ((i > 0) && (j < RAYGUI_MAX_PROPS_BASE) && ((guiStyleSet->overrides[j] & (1u << i)) == 0)) continue;
+
+            props[propertyCount].controlId = (unsigned short)i;
+            props[propertyCount].propertyId = (unsigned short)j;
+            props[propertyCount].propertyValue = (int)value;
+            propertyCount++;
+        }
+    }
+
+    int propsDataSize = ((propertyCount*8 + 15)/16)*16;
+    int fontDataSize = 0;
+
+#if !defined(RAYGUI_STANDALONE)
+    // Export custom font if available, default font is never exported
+    Image imFont = { 0 };
+    int imageDataSize = 0;
+
+    if ((guiFont.texture.id > 0) && (guiFont.texture.id != GetFontDefault().texture.id))
+    {
+        imFont = LoadImageFromTexture(guiFont.texture);
+        imageDataSize = GetPixelDataSize(imFont.width, imFont.height, imFont.format);
+        fontDataSize = 48 + guiFont.glyphCount*32 + ((imageDataSize + 15)/16)*16;
+    }
+#endif
+
+    *dataSize = 16 + propsDataSize + fontDataSize;
+    unsigned char *data = (unsigned char *)RAYGUI_CALLOC(*dataSize, 1);
+
+    // Style header: signature, version, reserved, properties count, font data size
+    short version = 500;
+    memcpy(data, "rGS ", 4);
+    memcpy(data + 4, &version, sizeof(short));
+    memcpy(data + 8, &propertyCount, sizeof(int));
+    memcpy(data + 12, &fontDataSize, sizeof(int));
+
+    // Style properties, same layout as GuiStyleProp
+    memcpy(data + 16, props, propertyCount*sizeof(GuiStyleProp));
+
+    RAYGUI_FREE(props);
+
+#if !defined(RAYGUI_STANDALONE)
+    if (fontDataSize > 0)
+    {
+        unsigned char *fontData = data + 16 + propsDataSize;
+
+        // Font white rectangle is only valid if shapes are drawn from font texture
+        Rectangle whiteRec = { 0 };
+        if (GetShapesTexture().id == guiFont.texture.id) whiteRec = GetShapesTextureRectangle();
+
+        int fontHeader[4] = { guiFont.baseSize, guiFont.glyphCount, 0, 0 };     // Base size, glyph count, font type (0-Normal), reserved
+        int imageHeader[4] = { imFont.width, imFont.height, imFont.format, imageDataSize };
+
+        memcpy(fontData, fontHeader, 16);
+        memcpy(fontData + 16, &whiteRec, sizeof(Rectangle));
+        memcpy(fontData + 32, imageHeader, 16);
+        memcpy(fontData + 48, guiFont.recs, guiFont.glyphCount*sizeof(Rectangle));
+        fontData += 48 + guiFont.glyphCount*sizeof(Rectangle);
+
+        for (int i = 0; i < guiFont.glyphCount; i++)
+        {
+            int glyph[4] = { guiFont.glyphs[i].value, guiFont.glyphs[i].offsetX, guiFont.glyphs[i].offsetY, guiFont.glyphs[i].advanceX };
+            memcpy(fontData + i*16, glyph, 16);
+        }
+
+        memcpy(fontData + guiFont.glyphCount*16, imFont.data, imageDataSize);
+
+        UnloadImage(imFont);
+    }
+#endif
+
+    return data;
+}
+
+// Unload style data
+// NOTE: Data used in place is released with style file data, if owned
+static void GuiUnloadStyleData(GuiStyleData *data)
+{
+    if (!data->inPlace)
+    {
+        RAYGUI_FREE(data->props);
+        RAYGUI_FREE(data->fontImage.data);
+        RAYGUI_FREE(data->font.recs);
+    }
+
+    RAYGUI_FREE(data->font.glyphs);
+    GuiUnloadStyleFile(data->fileData, data->fileDataSize);
+    memset(data, 0, sizeof(GuiStyleData));
+}
+
+// Load style file data, memory mapped if supported
+// NOTE: Mapped file pages are private copy-on-write pages, they are shared between processes while not modified,
+// if file can not be mapped, it is read into anonymous mapped memory, so it is unloaded the same way
+static unsigned char *GuiLoadStyleFile(const char *fileName, int *dataSize)
+{
+    unsigned char *fileData = NULL;
+    *dataSize = 0;
+
+#if defined(RAYGUI_STYLE_MMAP)
+    int fd = open(fileName, O_RDONLY);
+
+    if (fd >= 0)
+    {
+        struct stat fileStat = { 0 };
+
+        if ((fstat(fd, &fileStat) == 0) && (fileStat.st_size > 0) && (fileStat.st_size <= 0x7fffffff))
+        {
+            size_t fileSize = (size_t)fileStat.st_size;
+            void *map = mmap(NULL, fileSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+
+        #if defined(MAP_ANONYMOUS)
+            if (map == MAP_FAILED)
+            {
+                // File could not be mapped (file system not supporting it), file is read instead
+                map = mmap(NULL, fileSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+                size_t readSize = 0;
+
+                while ((map != MAP_FAILED) && (readSize < fileSize))
+                {
+                    ssize_t result = read(fd, (unsigned char *)map + readSize, fileSize - readSize);
+
+                    if (result > 0) readSize += (size_t)result;
+                    else
+                    {
+                        munmap(map, fileSize);
+                        map = MAP_FAILED;
+                    }
+                }
+            }
+        #endif
+
+            if (map != MAP_FAILED)
+            {
+                fileData = (unsigned char *)map;
+                *dataSize = (int)fileSize;
+            }
+        }
+
+        close(fd);
+    }
+#else
+    FILE *rgsFile = fopen(fileName, "rb");
+
+    if (rgsFile != NULL)
+    {
+        fseek(rgsFile, 0, SEEK_END);
+        int fileDataSize = ftell(rgsFile);
+        fseek(rgsFile, 0, SEEK_SET);
+
+        if (fileDataSize > 0)
+        {
+            fileData = (unsigned char *)RAYGUI_MALLOC(fileDataSize*sizeof(unsigned char));
+            *dataSize = (int)fread(fileData, sizeof(unsigned char), fileDataSize, rgsFile);
+        }
+
+        fclose(rgsFile);
+    }
+#endif
+
+    return fileData;
+}
+
+// Unload style file data
+static void GuiUnloadStyleFile(unsigned char *fileData, int dataSize)
+{
+    if (fileData == NULL) return;
+
+#if defined(RAYGUI_STYLE_MMAP)
+    munmap(fileData, (size_t)dataSize);
+#else
+    RAYGUI_FREE(fileData);
+#endif
+}
+
+#if !defined(RAYGUI_STANDALONE)
+// Get style font key, hash of font data
+// NOTE: Same font data loaded from different style files gets the same key
+static unsigned long long GuiGetStyleFontKey(const GuiStyleData *data, int imageDataSize)
+{
+    int fontParams[5] = { data->font.baseSize, data->font.glyphCount, data->fontImage.width, data->fontImage.height, data->fontImage.format };
+
+    unsigned long long key = GuiHashData(fontParams, sizeof(fontParams), RAYGUI_HASH_SEED);
+    key = GuiHashData(data->font.recs, data->font.glyphCount*sizeof(Rectangle), key);
+
+    for (int i = 0; i < data->font.glyphCount; i++)
+    {
+        int glyph[4] = { data->font.glyphs[i].value, data->font.glyphs[i].offsetX, data->font.glyphs[i].offsetY, data->font.glyphs[i].advanceX };
+        key = GuiHashData(glyph, sizeof(glyph), key);
+    }
+
+    return GuiHashData(data->fontImage.data, imageDataSize, key);
+}
+#endif
+
+// Get font from cache, reference added if found
+static bool GuiGetCachedFont(unsigned long long key, Font *font)
+{
+    for (int i = 0; i < RAYGUI_FONT_CACHE_SIZE; i++)
+    {
+        if ((guiFontCache[i].font.texture.id > 0) && (guiFontCache[i].key == key))
+        {
+            guiFontCache[i].refCount++;
+            guiFontCache[i].lastUsed = ++guiFontCacheCounter;
+            *font = guiFontCache[i].font;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Add font to cache, one reference
+// NOTE: Least recently used font not referenced is unloaded if cache is full,
+// font is not cached if all cached fonts are referenced
+static bool GuiAddCachedFont(unsigned long long key, Font font, unsigned char *fileData, int fileDataSize)
+{
+    int index = -1;
+
+    for (int i = 0; i < RAYGUI_FONT_CACHE_SIZE; i++)
+    {
+        if (guiFontCache[i].font.texture.id == 0)
+        {
+            index = i;
+            break;
+        }
+
+        if ((guiFontCache[i].refCount <= 0) && ((index == -1) || (guiFontCache[i].lastUsed < guiFontCache[index].lastUsed))) index = i;
+    }
+
+    if (index == -1)
+    {
+        RAYGUI_LOG("WARNING: Font cache is full, font is not cached\n");
+        return false;
+    }
+
+    if (guiFontCache[index].font.texture.id > 0)
+    {
+        GuiUnloadFontData(guiFontCache[index].font);
+        GuiUnloadStyleFile(guiFontCache[index].fileData, guiFontCache[index].fileDataSize);
+    }
+
+    guiFontCache[index].key = key;
+    guiFontCache[index].font = font;
+    guiFontCache[index].refCount = 1;
+    guiFontCache[index].lastUsed = ++guiFontCacheCounter;
+    guiFontCache[index].fileData = fileData;
+    guiFontCache[index].fileDataSize = fileDataSize;
+
+    return true;
+}
+
+// Release font reference
+// NOTE: Font is kept loaded in cache until required, returns false if font is not cached
+static bool GuiReleaseFont(Font font)
+{
+    for (int i = 0; i < RAYGUI_FONT_CACHE_SIZE; i++)
+    {
+        if ((font.texture.id > 0) && (guiFontCache[i].font.texture.id == font.texture.id))
+        {
+            if (guiFontCache[i].refCount > 0) guiFontCache[i].refCount--;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Set default font as gui font, previous font released or unloaded
+// NOTE: Fonts loaded by styles are released, they are unloaded once not referenced
+static void GuiLoadFontDefault(void)
+{
+    if (guiFont.texture.id == GetFontDefault().texture.id) return;
+
+    // Unload previous font texture (if loaded)
+    if ((guiFont.texture.id > 0) && !GuiReleaseFont(guiFont)) GuiUnloadFontData(guiFont);
+
+    // Setup default raylib font
+    guiFont = GetFontDefault();
+    GuiLoadGlyphTable();
+
+    // NOTE: Default raylib font character 95 is a white square
+    Rectangle whiteChar = guiFont.recs[95];
+
+    // NOTE: We set up a 1px padding on char rectangle to avoid pixel bleeding on MSAA filtering
+    SetShapesTexture(guiFont.texture, RAYGUI_CLITERAL(Rectangle){ whiteChar.x + 1, whiteChar.y + 1, whiteChar.width - 2, whiteChar.height - 2 });
+}
+
+// Unload font texture, recs and glyphs
+// NOTE: Font recs used in place from style file data are not freed
+static void GuiUnloadFontData(Font font)
+{
+    // Font glyphs lookup table is not valid anymore
+    for (int i = 0; i < RAYGUI_GLYPH_TABLE_CACHE_SIZE; i++)
+    {
+        if ((font.glyphs != NULL) && (guiGlyphTables[i].glyphs == font.glyphs))
+        {
+            RAYGUI_FREE(guiGlyphTables[i].sparse);
+            RAYGUI_FREE(guiGlyphTables[i].advances);
+            memset(&guiGlyphTables[i], 0, sizeof(GuiGlyphTable));
+        }
+    }
+
+    bool recsInPlace = false;
+
+    for (int i = 0; i < RAYGUI_FONT_CACHE_SIZE; i++)
+    {
+        const unsigned char *fileData = guiFontCache[i].fileData;
+
+        if ((fileData != NULL) && ((const unsigned char *)font.recs >= fileData) && ((const unsigned char *)font.recs < fileData + guiFontCache[i].fileDataSize)) recsInPlace = true;
+    }
+
+    UnloadTexture(font.texture);
+    if (!recsInPlace) RAYGUI_FREE(font.recs);
+    RAYGUI_FREE(font.glyphs);
+}
+
+// Gui get text width considering icon
+static int GetTextWidth(const char *text)
+{
+    #if !defined(ICON_TEXT_PADDING)
+        #define ICON_TEXT_PADDING   4
+    #endif
+    #if !defined(MAX_LINE_BUFFER_SIZE)
+        #define MAX_LINE_BUFFER_SIZE    256
+    #endif
+
+    Vector2 textSize = { 0 };
+    int textIconOffset = 0;
+
+    if ((text != NULL) && (text[0] != '\0'))
+    {
+        if (text[0] == '#')
+        {
+            for (int i = 1; (i < 5) && (text[i] != '\0'); i++)
+            {
+                if (text[i] == '#')
+                {
+                    textIconOffset = i;
+                    break;
+                }
+            }
+        }
+
+        text += textIconOffset;
+
+        // Make sure guiFont is set, GuiGetStyle() initializes it lazynessly
+        float fontSize = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
+
+        // Custom MeasureText() implementation
+        if ((guiFont.texture.id > 0) && (text != NULL))
+        {
+            // Get size in bytes of text, considering end of line and line break
+            int size = 0;
+            for (int i = 0; i < MAX_LINE_BUFFER_SIZE; i++)
+            {
+                if ((text[i] != '\0') && (text[i] != '\n')) size++;
+                else break;
+            }
+
+            textSize.y = fontSize;
+
+            float textSpacing = (float)GuiGetStyle(DEFAULT, TEXT_SPACING);
+            float measureParams[3] = { (float)guiFont.texture.id, fontSize, textSpacing };
+
+            unsigned long long hash = GuiHashData(text, size, RAYGUI_HASH_SEED);
+            hash = GuiHashData(measureParams, sizeof(measureParams), hash);
+
+            guiTextMeasuresCounter++;
+
+            // Check if text width is already available in cache, otherwise use least recently used entry
+            GuiTextMeasure *measure = &guiTextMeasures[0];
+            for (int i = 0; i < RAYGUI_TEXT_MEASURE_CACHE_SIZE; i++)
+            {
+                if ((guiTextMeasures[i].hash == hash) && (guiTextMeasures[i].size == size))
+                {
+                    measure = &guiTextMeasures[i];
+                    break;
+                }
+
+                if (guiTextMeasures[i].lastUsed < measure->lastUsed) measure = &guiTextMeasures[i];
+            }
+
+            if ((measure->hash == hash) && (measure->size == size))
+            {
+                textSize.x = measure->width;
+                guiTextMeasuresHits++;
+            }
+            else
+            {
+                const float *glyphAdvances = GuiGetGlyphAdvances();
+
+                for (int i = 0, codepointSize = 0; i < size; i += codepointSize)
+                {
+                    int codepoint = GetCodepointNext(&text[i], &codepointSize);
+
+                    textSize.x += (glyphAdvances[GuiGetGlyphIndex(codepoint)] + textSpacing);
+                }
+
+                measure->hash = hash;
+                measure->size = size;
+                measure->width = textSize.x;
+                guiTextMeasuresMisses++;
+            }
+
+            measure->lastUsed = guiTextMeasuresCounter;
+        }
+
+        if (textIconOffset > 0) textSize.x += (RAYGUI_ICON_SIZE - ICON_TEXT_PADDING);
+    }
+
+    return (int)textSize.x;
+}
+
+// Get control resolved style, rebuilt if required
+// NOTE: Resolved style is only rebuilt after GuiSetStyle(), GuiPushStyle()/GuiPopStyle() or GuiSetAlpha() changed it,
+// so controls drawing does not require checking overrides or converting style properties every frame
+static const GuiControlStyle *GuiGetControlStyle(int control)
+{
+    if (!guiStyleSet->loaded) GuiLoadStyleDefault();
+
+    GuiControlStyle *style = &guiControlStyles[control];
+
+    if (!guiControlStylesValid[control])
+    {
+        for (int i = 0; i < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED); i++) style->props[i] = GuiResolveStyle(control, i);
+        for (int i = 0; i < 12; i++) style->colors[i] = GuiFade(GetColor(style->props[i]), guiAlpha);
+
+        style->lineColor = GuiFade(GetColor(GuiResolveStyle(DEFAULT, LINE_COLOR)), guiAlpha);
+        style->backgroundColor = GuiFade(GetColor(GuiResolveStyle(DEFAULT, BACKGROUND_COLOR)), guiAlpha);
+
+        guiControlStylesValid[control] = true;
+    }
+
+    return style;
+}
+
+// Get style property value from active style set, no style overrides stack
+// NOTE: Controls inherit DEFAULT base properties if not overriding them
+static unsigned int GuiGetStyleValue(int control, int property)
+{
+    if ((property < RAYGUI_MAX_PROPS_BASE) && ((guiStyleSet->overrides[property] & (1u << control)) == 0)) control = DEFAULT;
+
+    return guiStyleSet->props[control*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + property];
+}
+
+// Get style property value, style overrides pushed checked first, last pushed first
+// NOTE: Used to build controls resolved styles, GuiGetStyle() reads resolved styles
+static int GuiResolveStyle(int control, int property)
+{
+    int count = (guiStyleStackCount < RAYGUI_STYLE_STACK_SIZE)? guiStyleStackCount : RAYGUI_STYLE_STACK_SIZE;
+
+    for (int i = count - 1; i >= 0; i--)
+    {
+        if ((guiStyleStack[i].property == property) &&
+            ((guiStyleStack[i].control == control) || ((guiStyleStack[i].control == DEFAULT) && (property < RAYGUI_MAX_PROPS_BASE)))) return guiStyleStack[i].value;
+    }
+
+    return (int)GuiGetStyleValue(control, property);
+}
+
+// Interpolate packed style color (0xRRGGBBAA), factor [0..256]
+// NOTE: Two channels are interpolated on every operation (SWAR), channels are kept
+// in separate 16 bit lanes so products (max 255*256) do not overflow into next channel
+static unsigned int GuiLerpStyleColor(unsigned int from, unsigned int to, unsigned int factor)
+{
+    unsigned int fromRB = from & 0x00ff00ff;
+    unsigned int fromGA = (from >> 8) & 0x00ff00ff;
+    unsigned int toRB = to & 0x00ff00ff;
+    unsigned int toGA = (to >> 8) & 0x00ff00ff;
+
+    unsigned int rb = ((fromRB*(256 - factor) + toRB*factor) >> 8) & 0x00ff00ff;
+    unsigned int ga = (fromGA*(256 - factor) + toGA*factor) & 0xff00ff00;
+
+    return (rb | ga);
+}
+
+// Update style overrides from style properties values
+// NOTE: Used for resolved values (style images), controls base properties
+// different from DEFAULT are considered overrides
+static void GuiUpdateStyleOverrides(void)
+{
+    const int propsPerControl = RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED;
+
+    for (int j = 0; j < RAYGUI_MAX_PROPS_BASE; j++)
+    {
+        guiStyleSet->overrides[j] = 0;
+
+        for (int i = 1; i < RAYGUI_MAX_CONTROLS; i++)
+        {
+            if (guiStyleSet->props[i*propsPerControl + j] != guiStyleSet->props[j]) guiStyleSet->overrides[j] |= (1u << i);
+        }
+    }
+}
+
+// Get control style color, global alpha already applied
+// NOTE: Base colors and DEFAULT specific colors are read from control resolved style
+static Color GuiGetStyleColor(int control, int property)
+{
+    const GuiControlStyle *style = GuiGetControlStyle(control);
+    Color color = { 0 };
+
+    if (property < 12) color = style->colors[property];
+    else if ((control == DEFAULT) && (property == LINE_COLOR)) color = style->lineColor;
+    else if ((control == DEFAULT) && (property == BACKGROUND_COLOR)) color = style->backgroundColor;
+    else color = GuiFade(GetColor(GuiGetStyle(control, property)), guiAlpha);
+
+    return color;
+}
+
+// Mark all controls resolved styles to be rebuilt
+static void GuiResetControlStyles(void)
+{
+    for (int i = 0; i < RAYGUI_MAX_CONTROLS; i++) guiControlStylesValid[i] = false;
+}
+
+// Mark controls resolved styles to be rebuilt if property value changes
+// NOTE: Used by style overrides, pushing or popping the value already in use keeps resolved styles valid,
+// DEFAULT base properties are checked against every control inheriting them, any DEFAULT property
+// change rebuilds all controls (DEFAULT line and background colors are resolved by every control)
+static void GuiInvalidateControlStyles(int control, int property, int value)
+{
+    if (control == DEFAULT)
+    {
+        bool changed = (GuiResolveStyle(DEFAULT, property) != value);
+
+        for (int i = 0; i < RAYGUI_MAX_CONTROLS; i++)
+        {
+            if (guiControlStylesValid[i] && (changed || ((property < RAYGUI_MAX_PROPS_BASE) && (GuiResolveStyle(i, property) != value)))) guiControlStylesValid[i] = false;
+        }
+    }
+    else if (guiControlStylesValid[control] && (GuiResolveStyle(control, property) != value)) guiControlStylesValid[control] = false;
+}
+
+// Get text bounds considering control bounds
+static Rectangle GetTextBounds(int control, Rectangle bounds)
+{
+    const GuiControlStyle *style = GuiGetControlStyle(control);
+    Rectangle textBounds = bounds;
+
+    int borderWidth = style->props[BORDER_WIDTH];
+    int textPadding = style->props[TEXT_PADDING];
+
+    textBounds.x = bounds.x + borderWidth;
+    textBounds.y = bounds.y + borderWidth + textPadding;
+    textBounds.width = bounds.width - 2*borderWidth - 2*textPadding;
+    textBounds.height = bounds.height - 2*borderWidth - 2*textPadding;    // NOTE: Text is processed line per line!
+
+    // Depending on control, TEXT_PADDING and TEXT_ALIGNMENT properties could affect the text-bounds
+    switch (control)
+    {
+        case COMBOBOX:
+        case DROPDOWNBOX:
+        case LISTVIEW:
+            // TODO: Special cases (no label): COMBOBOX, DROPDOWNBOX, LISTVIEW
+        case SLIDER:
+        case CHECKBOX:
+        case VALUEBOX:
+        case SPINNER:
+            // TODO: More special cases (label on side): SLIDER, CHECKBOX, VALUEBOX, SPINNER
+        default:
+        {
+            // TODO: WARNING: TEXT_ALIGNMENT is already considered in GuiDrawText()
+            if (style->props[TEXT_ALIGNMENT] == TEXT_ALIGN_RIGHT) textBounds.x -= textPadding;
+            else textBounds.x += textPadding;
+        }
+        break;
+    }
+
+    return textBounds;
+}
+
+// Get text icon if provided and move text cursor
+// NOTE: We support up to 999 values for iconId
+static const char *GetTextIcon(const char *text, int *iconId)
+{
+#if !defined(RAYGUI_NO_ICONS)
+    *iconId = -1;
+    if (text[0] == '#')     // Maybe we have an icon!
+    {
+        char iconValue[4] = { 0 };  // Maximum length for icon value: 3 digits + '\0'
+
+        int pos = 1;
+        while ((pos < 4) && (text[pos] >= '0') && (text[pos] <= '9'))
+        {
+            iconValue[pos - 1] = text[pos];
+            pos++;
+        }
+
+        if (text[pos] == '#')
+        {
+            *iconId = TextToInteger(iconValue);
+
+            // Move text pointer after icon
+            // WARNING: If only icon provided, it could point to EOL character: '\0'
+            if (*iconId >= 0) text += (pos + 1);
+        }
+    }
+#endif
+
+    return text;
+}
+
+// Get text divided into lines (by line-breaks '\n')
+const char **GetTextLines(const char *text, int *count)
+{
+    #define RAYGUI_MAX_TEXT_LINES   128
+
+    static const char *lines[RAYGUI_MAX_TEXT_LINES] = { 0 };
+    for (int i = 0; i < RAYGUI_MAX_TEXT_LINES; i++) lines[i] = NULL;    // Init NULL pointers to substrings
+
+    int textSize = (int)strlen(text);
+
+    lines[0] = text;
+    int len = 0;
+    *count = 1;
+    //int lineSize = 0;   // Stores current line size, not returned
+
+    for (int i = 0, k = 0; (i < textSize) && (*count < RAYGUI_MAX_TEXT_LINES); i++)
+    {
+        if (text[i] == '\n')
+        {
+            //lineSize = len;
+            k++;
+            lines[k] = &text[i + 1];     // WARNING: next value is valid?
+            len = 0;
+            *count += 1;
+        }
+        else len++;
+    }
+
+    //lines[*count - 1].size = len;
+
+    return lines;
+}
+
+// Get text input for current frame, all codepoints pressed encoded as UTF-8
+// NOTE: Pressed codepoints queue is fully drained, so no input is lost at low framerates,
+// raylib clears the queue every frame, so codepoints not fitting in text are dropped (not kept for next frame),
+// line break is added if ENTER is pressed on multiline mode, returns text size in bytes
+static int GetTextInput(char *text, int maxSize, bool multiline)
+{
+    int size = 0;
+    bool full = false;
+
+    for (int codepoint = GetCharPressed(); codepoint > 0; codepoint = GetCharPressed())
+    {
+        if ((codepoint >= 32) && !full)
+        {
+            int codepointSize = 0;
+            const char *charEncoded = CodepointToUTF8(codepoint, &codepointSize);
+
+            // Once a codepoint does not fit, following ones are dropped too, so input order is kept
+            if ((size + codepointSize) > maxSize) full = true;
+            else
+            {
+                memcpy(text + size, charEncoded, codepointSize);
+                size += codepointSize;
+            }
+        }
+    }
+
+    if (multiline && IsKeyPressed(KEY_ENTER) && (size < maxSize))
+    {
+        text[size] = '\n';
+        size++;
+    }
+
+    return size;
+}
+
+// Update automatic cursor movement timing (key repeat)
+// NOTE: Timing uses frame time, so key repeat speed does not depend on framerate,
+// at low framerates multiple cursor movements could be required in one frame
+static void UpdateAutoCursor(void)
+{
+    if (IsKeyDown(KEY_LEFT) || IsKeyDown(KEY_RIGHT) || IsKeyDown(KEY_UP) || IsKeyDown(KEY_DOWN) || IsKeyDown(KEY_BACKSPACE) || IsKeyDown(KEY_DELETE))
     {
-        memset(buffer, 0, 1024);
-        sprintf(buffer, "#%03i#", iconId);
+        float frameTime = GetFrameTime();
 
-        for (int i = 5; i < 1024; i++)
-        {
-            buffer[i] = text[i - 5];
-            if (text[i - 5] == '\0') break;
-        }
+        if (autoCursorCooldownTime < RAYGUI_TEXTBOX_AUTO_CURSOR_COOLDOWN_SECONDS) autoCursorCooldownTime += frameTime;
+        else autoCursorDelayTime += frameTime;
 
-        return buffer;
+        // Frame hitches (window moved, loading) do not trigger many movements at once,
+        // accumulated time is limited, not the movements per frame (repeat rate kept at low framerates)
+        if (autoCursorDelayTime > RAYGUI_TEXTBOX_AUTO_CURSOR_MAX_BACKLOG_SECONDS) autoCursorDelayTime = RAYGUI_TEXTBOX_AUTO_CURSOR_MAX_BACKLOG_SECONDS;
+
+        // One delay interval consumed per movement, remaining time kept for next frame
+        autoCursorRepeatCount = (int)(autoCursorDelayTime/RAYGUI_TEXTBOX_AUTO_CURSOR_DELAY_SECONDS);
+        autoCursorDelayTime -= autoCursorRepeatCount*RAYGUI_TEXTBOX_AUTO_CURSOR_DELAY_SECONDS;
     }
     else
     {
-        sprintf(iconBuffer, "#%03i#", iconId);
-
-        return iconBuffer;
+        autoCursorCooldownTime = 0.0f;      // GLOBAL: Cursor cooldown time
+        autoCursorDelayTime = 0.0f;         // GLOBAL: Cursor delay time
+        autoCursorRepeatCount = 0;          // GLOBAL: Cursor movements for current frame
     }
-#endif
 }
 
-#if !defined(RAYGUI_NO_ICONS)
-// Get full icons data pointer
-unsigned int *GuiGetIcons(void) { return guiIconsPtr; }
+// Get key pressed/repeated count for current frame
+// NOTE: Key pressed counts once, key down repeats after cooldown time
+static int GetKeyRepeatCount(int key)
+{
+    int count = 0;
 
-// Load raygui icons file (.rgi)
-// NOTE: In case nameIds are required, they can be requested with loadIconsName,
-// they are returned as a guiIconsName[iconCount][RAYGUI_ICON_MAX_NAME_LENGTH],
-// WARNING: guiIconsName[]][] memory should be manually freed!
-char **GuiLoadIcons(const char *fileName, bool loadIconsName)
+    if (IsKeyPressed(key)) count = 1;
+    else if (IsKeyDown(key)) count = autoCursorRepeatCount;
+
+    return count;
+}
+
+// Get word-wrap line breaks for one line of text, cached by text content and layout parameters
+// NOTE: Line breaks are returned as byte offsets where a new wrapped line starts,
+// every word is measured only once and words longer than width are wrapped at codepoint level
+static const int *GetTextLineBreaks(const char *text, int size, float width, int *count)
 {
-    // Style File Structure (.rgi)
-    // ------------------------------------------------------
-    // Offset  | Size    | Type       | Description
-    // ------------------------------------------------------
-    // 0       | 4       | char       | Signature: "rGI "
-    // 4       | 2       | short      | Version: 100
-    // 6       | 2       | short      | reserved
+    float textSpacing = (float)GuiGetStyle(DEFAULT, TEXT_SPACING);
 
-    // 8       | 2       | short      | Num icons (N)
-    // 10      | 2       | short      | Icons size (Options: 16, 32, 64) (S)
+    // NOTE: Width float bits are used, line breaks depend on exact width, not on its integer part
+    int widthBits = 0;
+    memcpy(&widthBits, &width, sizeof(float));
 
-    // Icons name id (32 bytes per name id)
-    // foreach (icon)
-    // {
-    //   12+32*i  | 32   | char       | Icon NameId
-    // }
+    int layoutParams[4] = { size, GuiGetStyle(DEFAULT, TEXT_SIZE), widthBits, (int)guiFont.texture.id };
 
-    // Icons data: One bit per pixel, stored as unsigned int array (depends on icon size)
-    // S*S pixels/32bit per unsigned int = K unsigned int per icon
-    // foreach (icon)
-    // {
-    //   ...   | K       | unsigned int | Icon Data
-    // }
+    unsigned long long hash = GuiHashData(text, size, RAYGUI_HASH_SEED);
+    hash = GuiHashData(layoutParams, sizeof(layoutParams), hash);
+    hash = GuiHashData(&textSpacing, sizeof(float), hash);
 
-    FILE *rgiFile = fopen(fileName, "rb");
+    guiTextLayoutsCounter++;
 
-    char **guiIconsName = NULL;
+    // Check if layout is already available in cache, otherwise use least recently used entry
+    GuiTextLayout *layout = &guiTextLayouts[0];
+    for (int i = 0; i < RAYGUI_TEXT_LAYOUT_CACHE_SIZE; i++)
+    {
+        if ((guiTextLayouts[i].hash == hash) && (guiTextLayouts[i].size == size))
+        {
+            guiTextLayouts[i].lastUsed = guiTextLayoutsCounter;
+            *count = guiTextLayouts[i].breakCount;
+            return guiTextLayouts[i].breaks;
+        }
 
-    if (rgiFile != NULL)
+        if (guiTextLayouts[i].lastUsed < layout->lastUsed) layout = &guiTextLayouts[i];
+    }
+
+    layout->hash = hash;
+    layout->size = size;
+    layout->breakCount = 0;
+    layout->lastUsed = guiTextLayoutsCounter;
+
+    const float *glyphAdvances = GuiGetGlyphAdvances();
+    float textOffsetX = 0.0f;
+    float wordWidth = -1.0f;    // Current word width, negative if not in a word
+
+    for (int c = 0, codepointSize = 0; c < size; c += codepointSize)
     {
-        char signature[5] = { 0 };
-        short version = 0;
-        short reserved = 0;
-        short iconCount = 0;
-        short iconSize = 0;
+        int codepoint = GetCodepointNext(&text[c], &codepointSize);
+        if (codepoint == 0x3f) codepointSize = 1;   // NOTE: Same bad bytes processing as GuiDrawText()
 
-        fread(signature, 1, 4, rgiFile);
-        fread(&version, sizeof(short), 1, rgiFile);
-        fread(&reserved, sizeof(short), 1, rgiFile);
-        fread(&iconCount, sizeof(short), 1, rgiFile);
-        fread(&iconSize, sizeof(short), 1, rgiFile);
+        float glyphWidth = glyphAdvances[GuiGetGlyphIndex(codepoint)];
+        int lineBreak = 0;
 
-        if ((signature[0] == 'r') &&
-            (signature[1] == 'G') &&
-            (signature[2] == 'I') &&
-            (signature[3] == ' '))
+        if (codepoint == ' ') wordWidth = -1.0f;
+        else
         {
-            if (loadIconsName)
+            if (wordWidth < 0.0f)
             {
-                guiIconsName = (char **)RAYGUI_MALLOC(iconCount*sizeof(char **));
-                for (int i = 0; i < iconCount; i++)
+                // New word found, measure it up to next space
+                wordWidth = 0.0f;
+                for (int k = c, size2 = 0; k < size; k += size2)
                 {
-                    guiIconsName[i] = (char *)RAYGUI_MALLOC(RAYGUI_ICON_MAX_NAME_LENGTH);
-                    fread(guiIconsName[i], 1, RAYGUI_ICON_MAX_NAME_LENGTH, rgiFile);
+                    int codepoint2 = GetCodepointNext(&text[k], &size2);
+                    if (codepoint2 == ' ') break;
+                    if (codepoint2 == 0x3f) size2 = 1;
+
+                    wordWidth += (glyphAdvances[GuiGetGlyphIndex(codepoint2)] + textSpacing);
                 }
+
+                // Move word to next line if it does not fit current line
+                if ((wordWidth <= width) && (textOffsetX > 0.0f) && ((textOffsetX + wordWidth) > width)) lineBreak = 1;
             }
-            else fseek(rgiFile, iconCount*RAYGUI_ICON_MAX_NAME_LENGTH, SEEK_CUR);
 
-            // Read icons data directly over internal icons array
-            fread(guiIconsPtr, sizeof(unsigned int), iconCount*(iconSize*iconSize/32), rgiFile);
+            // Wrap at codepoint level words longer than width
+            if ((wordWidth > width) && (textOffsetX > 0.0f) && ((textOffsetX + glyphWidth) > width)) lineBreak = 1;
         }
 
-        fclose(rgiFile);
-    }
-
-    return guiIconsName;
-}
-
-// Draw selected icon using rectangles pixel-by-pixel
-void GuiDrawIcon(int iconId, int posX, int posY, int pixelSize, Color color)
-{
-    #define BIT_CHECK(a,b) ((a) & (1u<<(b)))
-
-    for (int i = 0, y = 0; i < RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE/32; i++)
-    {
-        for (int k = 0; k < 32; k++)
+        if (lineBreak)
         {
-            if (BIT_CHECK(guiIconsPtr[iconId*RAYGUI_ICON_DATA_ELEMENTS + i], k))
+            if (layout->breakCount >= layout->breakCapacity)
             {
-            #if !defined(RAYGUI_STANDALONE)
-                GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ (float)posX + (k%RAYGUI_ICON_SIZE)*pixelSize, (float)posY + y*pixelSize, (float)pixelSize, (float)pixelSize }, 0, BLANK, color);
-            #endif
+                int *breaks = (int *)RAYGUI_MALLOC((layout->breakCapacity + 32)*sizeof(int));
+                if (layout->breakCount > 0) memcpy(breaks, layout->breaks, layout->breakCount*sizeof(int));
+                RAYGUI_FREE(layout->breaks);
+
+                layout->breaks = breaks;
+                layout->breakCapacity += 32;
             }
 
-            if ((k == 15) || (k == 31)) y++;
+            layout->breaks[layout->breakCount] = c;
+            layout->breakCount++;
+            textOffsetX = 0.0f;
         }
+
+        textOffsetX += (glyphWidth + textSpacing);
     }
+
+    *count = layout->breakCount;
+    return layout->breaks;
 }
 
-// Set icon drawing size
-void GuiSetIconScale(int scale)
+// Reset text measures and layouts caches
+// NOTE: Required when gui font or text metrics change
+static void GuiResetTextCache(void)
 {
-    if (scale >= 1) guiIconScale = scale;
+    for (int i = 0; i < RAYGUI_TEXT_MEASURE_CACHE_SIZE; i++) guiTextMeasures[i].size = -1;
+    for (int i = 0; i < RAYGUI_TEXT_LAYOUT_CACHE_SIZE; i++) guiTextLayouts[i].size = -1;
+    guiTextBoxIndex.text = NULL;
 }
 
-#endif      // !RAYGUI_NO_ICONS
-
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
-
-// Load style from memory
-// WARNING: Binary files only
-static void GuiLoadStyleFromMemory(const unsigned char *fileData, int dataSize)
+// Update text box prefix widths index
+// NOTE: Index is only rebuilt if text buffer, text length, text content or text style changed,
+// edits done by GuiTextBox() are applied incrementally with GuiTextBoxIndexInsert()/GuiTextBoxIndexDelete()
+static void GuiUpdateTextBoxIndex(const char *text, int length)
 {
-    unsigned char *fileDataPtr = (unsigned char *)fileData;
+    int textSize = GuiGetStyle(DEFAULT, TEXT_SIZE);
+    int textSpacing = GuiGetStyle(DEFAULT, TEXT_SPACING);
+    unsigned long long hash = GuiHashData(text, length, RAYGUI_HASH_SEED);
 
-    char signature[5] = { 0 };
-    short version = 0;
-    short reserved = 0;
-    int propertyCount = 0;
-
-    memcpy(signature, fileDataPtr, 4);
-    memcpy(&version, fileDataPtr + 4, sizeof(short));
-    memcpy(&reserved, fileDataPtr + 4 + 2, sizeof(short));
-    memcpy(&propertyCount, fileDataPtr + 4 + 2 + 2, sizeof(int));
-    fileDataPtr += 12;
+    if ((guiTextBoxIndex.text == text) &&
+        (guiTextBoxIndex.length == length) &&
+        (guiTextBoxIndex.hash == hash) &&
+        (guiTextBoxIndex.textSize == textSize) &&
+        (guiTextBoxIndex.textSpacing == textSpacing)) return;
 
-    if ((signature[0] == 'r') &&
-        (signature[1] == 'G') &&
-        (signature[2] == 'S') &&
-        (signature[3] == ' '))
+    if ((length + 1) > guiTextBoxIndex.capacity)
     {
-        short controlId = 0;
-        short propertyId = 0;
-        unsigned int propertyValue = 0;
-
-        for (int i = 0; i < propertyCount; i++)
-        {
-            memcpy(&controlId, fileDataPtr, sizeof(short));
-            memcpy(&propertyId, fileDataPtr + 2, sizeof(short));
-            memcpy(&propertyValue, fileDataPtr + 2 + 2, sizeof(unsigned int));
-            fileDataPtr += 8;
+        RAYGUI_FREE(guiTextBoxIndex.widths);
+        guiTextBoxIndex.capacity = length + 1 + 256;
+        guiTextBoxIndex.widths = (float *)RAYGUI_MALLOC(guiTextBoxIndex.capacity*sizeof(float));
+    }
 
-            if (controlId == 0) // DEFAULT control
-            {
-                // If a DEFAULT property is loaded, it is propagated to all controls
-                // NOTE: All DEFAULT properties should be defined first in the file
-                GuiSetStyle(0, (int)propertyId, propertyValue);
+    guiTextBoxIndex.text = text;
+    guiTextBoxIndex.length = length;
+    guiTextBoxIndex.hash = hash;
+    guiTextBoxIndex.textSize = textSize;
+    guiTextBoxIndex.textSpacing = textSpacing;
 
-                if (propertyId < RAYGUI_MAX_PROPS_BASE) for (int i = 1; i < RAYGUI_MAX_CONTROLS; i++) GuiSetStyle(i, (int)propertyId, propertyValue);
-            }
-            else GuiSetStyle((int)controlId, (int)propertyId, propertyValue);
-        }
+    const float *glyphAdvances = GuiGetGlyphAdvances();
+    float *widths = guiTextBoxIndex.widths;
+    widths[0] = 0.0f;
 
-        // Font loading is highly dependant on raylib API to load font data and image
+    for (int i = 0, codepointSize = 0; i < length; i += codepointSize)
+    {
+        int codepoint = GetCodepointNext(&text[i], &codepointSize);
+        if ((i + codepointSize) > length) codepointSize = length - i;
 
-#if !defined(RAYGUI_STANDALONE)
-        // Load custom font if available
-        int fontDataSize = 0;
-        memcpy(&fontDataSize, fileDataPtr, sizeof(int));
-        fileDataPtr += 4;
+        for (int k = 1; k < codepointSize; k++) widths[i + k] = widths[i];
+        widths[i + codepointSize] = widths[i] + glyphAdvances[GuiGetGlyphIndex(codepoint)] + (float)textSpacing;
+    }
+}
 
-        if (fontDataSize > 0)
-        {
-            Font font = { 0 };
-            int fontType = 0;   // 0-Normal, 1-SDF
-
-            memcpy(&font.baseSize, fileDataPtr, sizeof(int));
-            memcpy(&font.glyphCount, fileDataPtr + 4, sizeof(int));
-            memcpy(&fontType, fileDataPtr + 4 + 4, sizeof(int));
-            fileDataPtr += 12;
-
-            // Load font white rectangle
-            Rectangle fontWhiteRec = { 0 };
-            memcpy(&fontWhiteRec, fileDataPtr, sizeof(Rectangle));
-            fileDataPtr += 16;
-
-            // Load font image parameters
-            int fontImageUncompSize = 0;
-            int fontImageCompSize = 0;
-            memcpy(&fontImageUncompSize, fileDataPtr, sizeof(int));
-            memcpy(&fontImageCompSize, fileDataPtr + 4, sizeof(int));
-            fileDataPtr += 8;
-
-            Image imFont = { 0 };
-            imFont.mipmaps = 1;
-            memcpy(&imFont.width, fileDataPtr, sizeof(int));
-            memcpy(&imFont.height, fileDataPtr + 4, sizeof(int));
-            memcpy(&imFont.format, fileDataPtr + 4 + 4, sizeof(int));
-            fileDataPtr += 12;
-
-            if ((fontImageCompSize > 0) && (fontImageCompSize != fontImageUncompSize))
-            {
-                // Compressed font atlas image data (DEFLATE), it requires DecompressData()
-                int dataUncompSize = 0;
-                unsigned char *compData = (unsigned char *)RAYGUI_MALLOC(fontImageCompSize);
-                memcpy(compData, fileDataPtr, fontImageCompSize);
-                fileDataPtr += fontImageCompSize;
+// Update text box index for text inserted at index (size in bytes)
+// NOTE: Only inserted codepoints are measured, following widths are displaced
+static void GuiTextBoxIndexInsert(const char *text, int index, int size)
+{
+    int length = guiTextBoxIndex.length + size;
 
-                imFont.data = DecompressData(compData, fontImageCompSize, &dataUncompSize);
+    if ((length + 1) > guiTextBoxIndex.capacity)
+    {
+        guiTextBoxIndex.capacity = length + 1 + 256;
+        float *widths = (float *)RAYGUI_MALLOC(guiTextBoxIndex.capacity*sizeof(float));
+        memcpy(widths, guiTextBoxIndex.widths, (guiTextBoxIndex.length + 1)*sizeof(float));
+        RAYGUI_FREE(guiTextBoxIndex.widths);
+        guiTextBoxIndex.widths = widths;
+    }
 
-                // Security check, dataUncompSize must match the provided fontImageUncompSize
-                if (dataUncompSize != fontImageUncompSize) RAYGUI_LOG("WARNING: Uncompressed font atlas image data could be corrupted");
+    float *widths = guiTextBoxIndex.widths;
+    memmove(widths + index + size, widths + index, (guiTextBoxIndex.length - index + 1)*sizeof(float));
 
-                RAYGUI_FREE(compData);
-            }
-            else
-            {
-                // Font atlas image data is not compressed
-                imFont.data = (unsigned char *)RAYGUI_MALLOC(fontImageUncompSize);
-                memcpy(imFont.data, fileDataPtr, fontImageUncompSize);
-                fileDataPtr += fontImageUncompSize;
-            }
+    const float *glyphAdvances = GuiGetGlyphAdvances();
+    float insertWidth = 0.0f;
 
-            if (font.texture.id != GetFontDefault().texture.id) UnloadTexture(font.texture);
-            font.texture = LoadTextureFromImage(imFont);
+    for (int i = index, codepointSize = 0; i < (index + size); i += codepointSize)
+    {
+        int codepoint = GetCodepointNext(&text[i], &codepointSize);
+        if ((i + codepointSize) > (index + size)) codepointSize = index + size - i;
 
-            RAYGUI_FREE(imFont.data);
+        for (int k = 0; k < codepointSize; k++) widths[i + k] = widths[index] + insertWidth;
+        insertWidth += (glyphAdvances[GuiGetGlyphIndex(codepoint)] + (float)guiTextBoxIndex.textSpacing);
+    }
 
-            // Validate font atlas texture was loaded correctly
-            if (font.texture.id != 0)
-            {
-                // Load font recs data
-                int recsDataSize = font.glyphCount*sizeof(Rectangle);
-                int recsDataCompressedSize = 0;
+    for (int i = index + size; i <= length; i++) widths[i] += insertWidth;
 
-                // WARNING: Version 400 adds the compression size parameter
-                if (version >= 400)
-                {
-                    // RGS files version 400 support compressed recs data
-                    memcpy(&recsDataCompressedSize, fileDataPtr, sizeof(int));
-                    fileDataPtr += sizeof(int);
-                }
+    guiTextBoxIndex.length = length;
+    guiTextBoxIndex.hash = GuiHashData(text, length, RAYGUI_HASH_SEED);
+}
 
-                if ((recsDataCompressedSize > 0) && (recsDataCompressedSize != recsDataSize))
-                {
-                    // Recs data is compressed, uncompress it
-                    unsigned char *recsDataCompressed = (unsigned char *)RAYGUI_MALLOC(recsDataCompressedSize);
+// Update text box index for codepoint deleted from text at index (size in bytes)
+static void GuiTextBoxIndexDelete(const char *text, int index, int size)
+{
+    int length = guiTextBoxIndex.length - size;
+    float *widths = guiTextBoxIndex.widths;
+    float codepointWidth = widths[index + size] - widths[index];
 
-                    memcpy(recsDataCompressed, fileDataPtr, recsDataCompressedSize);
-                    fileDataPtr += recsDataCompressedSize;
+    memmove(widths + index, widths + index + size, (guiTextBoxIndex.length - index - size + 1)*sizeof(float));
+    for (int i = index; i <= length; i++) widths[i] -= codepointWidth;
 
-                    int recsDataUncompSize = 0;
-                    font.recs = (Rectangle *)DecompressData(recsDataCompressed, recsDataCompressedSize, &recsDataUncompSize);
+    guiTextBoxIndex.length = length;
+    guiTextBoxIndex.hash = GuiHashData(text, length, RAYGUI_HASH_SEED);
+}
 
-                    // Security check, data uncompressed size must match the expected original data size
-                    if (recsDataUncompSize != recsDataSize) RAYGUI_LOG("WARNING: Uncompressed font recs data could be corrupted");
+// Get first text box index with prefix width bigger than width, maxIndex if not found
+// NOTE: Binary search, returned index is always the first byte of a codepoint
+static int GuiTextBoxIndexSearch(float width, int maxIndex)
+{
+    const float *widths = guiTextBoxIndex.widths;
+    int first = 0;
+    int last = maxIndex;
 
-                    RAYGUI_FREE(recsDataCompressed);
-                }
-                else
-                {
-                    // Recs data is uncompressed
-                    font.recs = (Rectangle *)RAYGUI_CALLOC(font.glyphCount, sizeof(Rectangle));
-                    for (int i = 0; i < font.glyphCount; i++)
-                    {
-                        memcpy(&font.recs[i], fileDataPtr, sizeof(Rectangle));
-                        fileDataPtr += sizeof(Rectangle);
-                    }
-                }
+    while (first < last)
+    {
+        int middle = first + (last - first)/2;
 
-                // Load font glyphs info data
-                int glyphsDataSize = font.glyphCount*16;    // 16 bytes data per glyph
-                int glyphsDataCompressedSize = 0;
+        if (widths[middle] > width) last = middle;
+        else first = middle + 1;
+    }
 
-                // WARNING: Version 400 adds the compression size parameter
-                if (version >= 400)
-                {
-                    // RGS files version 400 support compressed glyphs data
-                    memcpy(&glyphsDataCompressedSize, fileDataPtr, sizeof(int));
-                    fileDataPtr += sizeof(int);
-                }
+    return first;
+}
 
-                // Allocate required glyphs space to fill with data
-                font.glyphs = (GlyphInfo *)RAYGUI_CALLOC(font.glyphCount, sizeof(GlyphInfo));
+// Move text buffer gap (cursor) to text position
+// NOTE: Only text between current gap position and new position is moved
+static void GuiTextBufferMoveGap(GuiTextBuffer *buffer, int position)
+{
+    if (position < buffer->gapStart)
+    {
+        int size = buffer->gapStart - position;
+        memmove(buffer->data + buffer->gapEnd - size, buffer->data + position, size);
 
-                if ((glyphsDataCompressedSize > 0) && (glyphsDataCompressedSize != glyphsDataSize))
-                {
-                    // Glyphs data is compressed, uncompress it
-                    unsigned char *glypsDataCompressed = (unsigned char *)RAYGUI_MALLOC(glyphsDataCompressedSize);
+        buffer->gapStart -= size;
+        buffer->gapEnd -= size;
+    }
+    else if ((position > buffer->gapStart) && (position <= buffer->length))
+    {
+        int size = position - buffer->gapStart;
+        memmove(buffer->data + buffer->gapStart, buffer->data + buffer->gapEnd, size);
 
-                    memcpy(glypsDataCompressed, fileDataPtr, glyphsDataCompressedSize);
-                    fileDataPtr += glyphsDataCompressedSize;
+        buffer->gapStart += size;
+        buffer->gapEnd += size;
+    }
+}
 
-                    int glyphsDataUncompSize = 0;
-                    unsigned char *glyphsDataUncomp = DecompressData(glypsDataCompressed, glyphsDataCompressedSize, &glyphsDataUncompSize);
+// Insert text at text buffer gap (cursor), cursor is moved after inserted text
+// NOTE: Text data capacity is doubled when gap is full, keeping insertion amortized O(1)
+static void GuiTextBufferInsert(GuiTextBuffer *buffer, const char *text, int size)
+{
+    if ((buffer->gapEnd - buffer->gapStart) < size)
+    {
+        int capacity = buffer->capacity*2 + size;
+        int tailSize = buffer->capacity - buffer->gapEnd;
+        char *data = (char *)RAYGUI_MALLOC(capacity);
 
-                    // Security check, data uncompressed size must match the expected original data size
-                    if (glyphsDataUncompSize != glyphsDataSize) RAYGUI_LOG("WARNING: Uncompressed font glyphs data could be corrupted");
+        memcpy(data, buffer->data, buffer->gapStart);
+        memcpy(data + capacity - tailSize, buffer->data + buffer->gapEnd, tailSize);
+        RAYGUI_FREE(buffer->data);
 
-                    unsigned char *glyphsDataUncompPtr = glyphsDataUncomp;
+        buffer->data = data;
+        buffer->gapEnd = capacity - tailSize;
+        buffer->capacity = capacity;
+    }
 
-                    for (int i = 0; i < font.glyphCount; i++)
-                    {
-                        memcpy(&font.glyphs[i].value, glyphsDataUncompPtr, sizeof(int));
-                        memcpy(&font.glyphs[i].offsetX, glyphsDataUncompPtr + 4, sizeof(int));
-                        memcpy(&font.glyphs[i].offsetY, glyphsDataUncompPtr + 8, sizeof(int));
-                        memcpy(&font.glyphs[i].advanceX, glyphsDataUncompPtr + 12, sizeof(int));
-                        glyphsDataUncompPtr += 16;
-                    }
+    int position = buffer->gapStart;
+    memcpy(buffer->data + position, text, size);
 
-                    RAYGUI_FREE(glypsDataCompressed);
-                    RAYGUI_FREE(glyphsDataUncomp);
-                }
-                else
-                {
-                    // Glyphs data is uncompressed
-                    for (int i = 0; i < font.glyphCount; i++)
-                    {
-                        memcpy(&font.glyphs[i].value, fileDataPtr, sizeof(int));
-                        memcpy(&font.glyphs[i].offsetX, fileDataPtr + 4, sizeof(int));
-                        memcpy(&font.glyphs[i].offsetY, fileDataPtr + 8, sizeof(int));
-                        memcpy(&font.glyphs[i].advanceX, fileDataPtr + 12, sizeof(int));
-                        fileDataPtr += 16;
-                    }
-                }
-            }
-            else font = GetFontDefault();   // Fallback in case of errors loading font atlas texture
+    buffer->gapStart += size;
+    buffer->length += size;
 
-            GuiSetFont(font);
+    // Update lines start positions after insert position
+    int line = GuiTextBufferGetLine(buffer, position) + 1;
+    for (int i = line; i < buffer->lineCount; i++) buffer->lineStarts[i] += size;
 
-            // Set font texture source rectangle to be used as white texture to draw shapes
-            // NOTE: It makes possible to draw shapes and text (full UI) in a single draw call
-            if ((fontWhiteRec.x > 0) &&
-                (fontWhiteRec.y > 0) &&
-                (fontWhiteRec.width > 0) &&
-                (fontWhiteRec.height > 0)) SetShapesTexture(font.texture, fontWhiteRec);
+    for (int i = 0; i < size; i++)
+    {
+        if (text[i] == '\n')
+        {
+            GuiTextBufferInsertLine(buffer, line, position + i + 1);
+            line++;
         }
-#endif
     }
 }
 
-// Gui get text width considering icon
-static int GetTextWidth(const char *text)
+// Delete text range from text buffer, cursor is moved to range position
+static void GuiTextBufferDelete(GuiTextBuffer *buffer, int position, int size)
 {
-    #if !defined(ICON_TEXT_PADDING)
-        #define ICON_TEXT_PADDING   4
-    #endif
+    if ((position < 0) || (position >= buffer->length)) return;
+    if ((position + size) > buffer->length) size = buffer->length - position;
 
-    Vector2 textSize = { 0 };
-    int textIconOffset = 0;
+    GuiTextBufferMoveGap(buffer, position);
 
-    if ((text != NULL) && (text[0] != '\0'))
-    {
-        if (text[0] == '#')
-        {
-            for (int i = 1; (i < 5) && (text[i] != '\0'); i++)
-            {
-                if (text[i] == '#')
-                {
-                    textIconOffset = i;
-                    break;
-                }
-            }
-        }
+    buffer->gapEnd += size;
+    buffer->length -= size;
 
-        text += textIconOffset;
+    // Update lines start positions, removing lines with deleted line break
+    int line = GuiTextBufferGetLine(buffer, position) + 1;
+    int removed = 0;
 
-        // Make sure guiFont is set, GuiGetStyle() initializes it lazynessly
-        float fontSize = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
+    while (((line + removed) < buffer->lineCount) && (buffer->lineStarts[line + removed] <= (position + size))) removed++;
 
-        // Custom MeasureText() implementation
-        if ((guiFont.texture.id > 0) && (text != NULL))
-        {
-            // Get size in bytes of text, considering end of line and line break
-            int size = 0;
-            for (int i = 0; i < MAX_LINE_BUFFER_SIZE; i++)
-            {
-                if ((text[i] != '\0') && (text[i] != '\n')) size++;
-                else break;
-            }
+    if (removed > 0) memmove(buffer->lineStarts + line, buffer->lineStarts + line + removed, (buffer->lineCount - line - removed)*sizeof(int));
+    buffer->lineCount -= removed;
 
-            float scaleFactor = fontSize/(float)guiFont.baseSize;
-            textSize.y = (float)guiFont.baseSize*scaleFactor;
-            float glyphWidth = 0.0f;
+    for (int i = line; i < buffer->lineCount; i++) buffer->lineStarts[i] -= size;
+}
 
-            for (int i = 0, codepointSize = 0; i < size; i += codepointSize)
-            {
-                int codepoint = GetCodepointNext(&text[i], &codepointSize);
-                int codepointIndex = GetGlyphIndex(guiFont, codepoint);
+// Insert line start position in text buffer lines, at provided line index
+static void GuiTextBufferInsertLine(GuiTextBuffer *buffer, int line, int position)
+{
+    if (buffer->lineCount >= buffer->lineCapacity)
+    {
+        int *lineStarts = (int *)RAYGUI_MALLOC(buffer->lineCapacity*2*sizeof(int));
+        memcpy(lineStarts, buffer->lineStarts, buffer->lineCount*sizeof(int));
+        RAYGUI_FREE(buffer->lineStarts);
 
-                if (guiFont.glyphs[codepointIndex].advanceX == 0) glyphWidth = ((float)guiFont.recs[codepointIndex].width*scaleFactor);
-                else glyphWidth = ((float)guiFont.glyphs[codepointIndex].advanceX*scaleFactor);
+        buffer->lineStarts = lineStarts;
+        buffer->lineCapacity *= 2;
+    }
 
-                textSize.x += (glyphWidth + (float)GuiGetStyle(DEFAULT, TEXT_SPACING));
-            }
-        }
+    memmove(buffer->lineStarts + line + 1, buffer->lineStarts + line, (buffer->lineCount - line)*sizeof(int));
+    buffer->lineStarts[line] = position;
+    buffer->lineCount++;
+}
 
-        if (textIconOffset > 0) textSize.x += (RAYGUI_ICON_SIZE - ICON_TEXT_PADDING);
-    }
+// Get codepoint at text buffer position
+// NOTE: Codepoint bytes are copied to avoid reading out of text segment on bad UTF-8 bytes
+static int GuiTextBufferCodepoint(const GuiTextBuffer *buffer, int position, int *codepointSize)
+{
+    char bytes[5] = { 0 };
+    int gapSize = buffer->gapEnd - buffer->gapStart;
+    int end = (position < buffer->gapStart)? buffer->gapStart : buffer->length;
+    const char *ptr = buffer->data + position + ((position < buffer->gapStart)? 0 : gapSize);
 
-    return (int)textSize.x;
+    for (int i = 0; (i < 4) && ((position + i) < end); i++) bytes[i] = ptr[i];
+
+    return GetCodepointNext(bytes, codepointSize);
 }
 
-// Get text bounds considering control bounds
-static Rectangle GetTextBounds(int control, Rectangle bounds)
+// Get previous codepoint position in text buffer
+static int GuiTextBufferPrevious(const GuiTextBuffer *buffer, int position)
 {
-    Rectangle textBounds = bounds;
+    int gapSize = buffer->gapEnd - buffer->gapStart;
+    int previous = position - 1;
 
-    textBounds.x = bounds.x + GuiGetStyle(control, BORDER_WIDTH);
-    textBounds.y = bounds.y + GuiGetStyle(control, BORDER_WIDTH) + GuiGetStyle(control, TEXT_PADDING);
-    textBounds.width = bounds.width - 2*GuiGetStyle(control, BORDER_WIDTH) - 2*GuiGetStyle(control, TEXT_PADDING);
-    textBounds.height = bounds.height - 2*GuiGetStyle(control, BORDER_WIDTH) - 2*GuiGetStyle(control, TEXT_PADDING);    // NOTE: Text is processed line per line!
+    // Move back over UTF-8 continuation bytes (10xxxxxx)
+    while ((previous > 0) && ((position - previous) < 4) &&
+           ((buffer->data[previous + ((previous < buffer->gapStart)? 0 : gapSize)] & 0xc0) == 0x80)) previous--;
 
-    // Depending on control, TEXT_PADDING and TEXT_ALIGNMENT properties could affect the text-bounds
-    switch (control)
-    {
-        case COMBOBOX:
-        case DROPDOWNBOX:
-        case LISTVIEW:
-            // TODO: Special cases (no label): COMBOBOX, DROPDOWNBOX, LISTVIEW
-        case SLIDER:
-        case CHECKBOX:
-        case VALUEBOX:
-        case SPINNER:
-            // TODO: More special cases (label on side): SLIDER, CHECKBOX, VALUEBOX, SPINNER
-        default:
-        {
-            // TODO: WARNING: TEXT_ALIGNMENT is already considered in GuiDrawText()
-            if (GuiGetStyle(control, TEXT_ALIGNMENT) == TEXT_ALIGN_RIGHT) textBounds.x -= GuiGetStyle(control, TEXT_PADDING);
-            else textBounds.x += GuiGetStyle(control, TEXT_PADDING);
-        }
-        break;
-    }
+    // Bad UTF-8 bytes are processed one by one
+    int codepointSize = 0;
+    GuiTextBufferCodepoint(buffer, previous, &codepointSize);
+    if ((previous + codepointSize) != position) previous = position - 1;
 
-    return textBounds;
+    return (previous < 0)? 0 : previous;
 }
 
-// Get text icon if provided and move text cursor
-// NOTE: We support up to 999 values for iconId
-static const char *GetTextIcon(const char *text, int *iconId)
+// Get text buffer line containing text position, using lines start positions
+static int GuiTextBufferGetLine(const GuiTextBuffer *buffer, int position)
 {
-#if !defined(RAYGUI_NO_ICONS)
-    *iconId = -1;
-    if (text[0] == '#')     // Maybe we have an icon!
-    {
-        char iconValue[4] = { 0 };  // Maximum length for icon value: 3 digits + '\0'
+    int first = 0;
+    int last = buffer->lineCount - 1;
 
-        int pos = 1;
-        while ((pos < 4) && (text[pos] >= '0') && (text[pos] <= '9'))
-        {
-            iconValue[pos - 1] = text[pos];
-            pos++;
-        }
-
-        if (text[pos] == '#')
-        {
-            *iconId = TextToInteger(iconValue);
+    while (first < last)
+    {
+        int middle = first + (last - first + 1)/2;
 
-            // Move text pointer after icon
-            // WARNING: If only icon provided, it could point to EOL character: '\0'
-            if (*iconId >= 0) text += (pos + 1);
-        }
+        if (buffer->lineStarts[middle] <= position) first = middle;
+        else last = middle - 1;
     }
-#endif
 
-    return text;
+    return first;
 }
 
-// Get text divided into lines (by line-breaks '\n')
-const char **GetTextLines(const char *text, int *count)
+// Get text buffer line end position (line break position or text end)
+static int GuiTextBufferGetLineEnd(const GuiTextBuffer *buffer, int line)
 {
-    #define RAYGUI_MAX_TEXT_LINES   128
+    return (line < (buffer->lineCount - 1))? (buffer->lineStarts[line + 1] - 1) : buffer->length;
+}
 
-    static const char *lines[RAYGUI_MAX_TEXT_LINES] = { 0 };
-    for (int i = 0; i < RAYGUI_MAX_TEXT_LINES; i++) lines[i] = NULL;    // Init NULL pointers to substrings
+// Get text buffer line position closest to width, considering glyphs center
+static int GuiTextBufferGetPosition(const GuiTextBuffer *buffer, int line, float width)
+{
+    const float *glyphAdvances = GuiGetGlyphAdvances();
+    float textSpacing = (float)GuiGetStyle(DEFAULT, TEXT_SPACING);
+    float textOffsetX = 0.0f;
+    int lineEnd = GuiTextBufferGetLineEnd(buffer, line);
 
-    int textSize = (int)strlen(text);
+    for (int i = buffer->lineStarts[line], codepointSize = 0; i < lineEnd; i += codepointSize)
+    {
+        float glyphWidth = glyphAdvances[GuiGetGlyphIndex(GuiTextBufferCodepoint(buffer, i, &codepointSize))];
 
-    lines[0] = text;
-    int len = 0;
-    *count = 1;
-    //int lineSize = 0;   // Stores current line size, not returned
+        if (width <= (textOffsetX + glyphWidth/2)) return i;
 
-    for (int i = 0, k = 0; (i < textSize) && (*count < RAYGUI_MAX_TEXT_LINES); i++)
-    {
-        if (text[i] == '\n')
-        {
-            //lineSize = len;
-            k++;
-            lines[k] = &text[i + 1];     // WARNING: next value is valid?
-            len = 0;
-            *count += 1;
-        }
-        else len++;
+        textOffsetX += (glyphWidth + textSpacing);
     }
 
-    //lines[*count - 1].size = len;
-
-    return lines;
+    return lineEnd;
 }
 
-// Get text width to next space for provided string
-static float GetNextSpaceWidth(const char *text, int *nextSpaceIndex)
+// Get text buffer range width
+static float GuiTextBufferGetWidth(const GuiTextBuffer *buffer, int start, int end)
 {
-    float width = 0;
-    int codepointByteCount = 0;
-    int codepoint = 0;
-    int index = 0;
-    float glyphWidth = 0;
-    float scaleFactor = (float)GuiGetStyle(DEFAULT, TEXT_SIZE)/guiFont.baseSize;
+    const float *glyphAdvances = GuiGetGlyphAdvances();
+    float textSpacing = (float)GuiGetStyle(DEFAULT, TEXT_SPACING);
+    float width = 0.0f;
 
-    for (int i = 0; text[i] != '\0'; i++)
+    for (int i = start, codepointSize = 0; i < end; i += codepointSize)
     {
-        if (text[i] != ' ')
-        {
-            codepoint = GetCodepoint(&text[i], &codepointByteCount);
-            index = GetGlyphIndex(guiFont, codepoint);
-            glyphWidth = (guiFont.glyphs[index].advanceX == 0)? guiFont.recs[index].width*scaleFactor : guiFont.glyphs[index].advanceX*scaleFactor;
-            width += (glyphWidth + (float)GuiGetStyle(DEFAULT, TEXT_SPACING));
-        }
-        else
-        {
-            *nextSpaceIndex = i;
-            break;
-        }
+        width += (glyphAdvances[GuiGetGlyphIndex(GuiTextBufferCodepoint(buffer, i, &codepointSize))] + textSpacing);
     }
 
     return width;
 }
 
+// Get FNV-1a hash for provided data, seed could be a previous hash to combine multiple data
+static unsigned long long GuiHashData(const void *data, int size, unsigned long long seed)
+{
+    const unsigned char *bytes = (const unsigned char *)data;
+    unsigned long long hash = seed;
+
+    for (int i = 0; i < size; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
 // Gui draw text using default font
+// NOTE: Tint color is expected to already include global alpha, see GuiGetStyleColor()
 static void GuiDrawText(const char *text, Rectangle textBounds, int alignment, Color tint)
 {
     #define TEXT_VALIGN_PIXEL_OFFSET(h)  ((int)h%2)     // Vertical alignment for pixel perfect
@@ -4785,6 +7843,10 @@ static void GuiDrawText(const char *text, Rectangle textBounds, int alignment, C
 
     if ((text == NULL) || (text[0] == '\0')) return;    // Security check
 
+#if defined(RAYGUI_COMMAND_LIST)
+    GuiBeginDrawItem(0, textBounds);
+#endif
+
     // PROCEDURE:
     //   - Text is processed line per line
     //   - For every line, horizontal alignment is defined
@@ -4860,7 +7922,7 @@ static void GuiDrawText(const char *text, Rectangle textBounds, int alignment, C
         if (iconId >= 0)
         {
             // NOTE: We consider icon height, probably different than text size
-            GuiDrawIcon(iconId, (int)textBoundsPosition.x, (int)(textBounds.y + textBounds.height/2 - RAYGUI_ICON_SIZE*guiIconScale/2 + TEXT_VALIGN_PIXEL_OFFSET(textBounds.height)), guiIconScale, tint);
+            GuiDrawIconColor(iconId, (int)textBoundsPosition.x, (int)(textBounds.y + textBounds.height/2 - RAYGUI_ICON_SIZE*guiIconScale/2 + TEXT_VALIGN_PIXEL_OFFSET(textBounds.height)), guiIconScale, tint);
             textBoundsPosition.x += (RAYGUI_ICON_SIZE*guiIconScale + ICON_TEXT_PADDING);
         }
 #endif
@@ -4868,10 +7930,13 @@ static void GuiDrawText(const char *text, Rectangle textBounds, int alignment, C
         // considering end of line and line break
         int lineSize = 0;
         for (int c = 0; (lines[i][c] != '\0') && (lines[i][c] != '\n') && (lines[i][c] != '\r'); c++, lineSize++){ }
-        float scaleFactor = (float)GuiGetStyle(DEFAULT, TEXT_SIZE)/guiFont.baseSize;
+        const float *glyphAdvances = GuiGetGlyphAdvances();
 
-        int lastSpaceIndex = 0;
-        bool tempWrapCharMode = false;
+        // Get word-wrap line breaks, computed once per line text
+        const int *lineBreaks = NULL;
+        int lineBreakCount = 0;
+        int nextLineBreak = 0;
+        if (wrapMode == TEXT_WRAP_WORD) lineBreaks = GetTextLineBreaks(lines[i], lineSize, textBounds.width, &lineBreakCount);
 
         int textOffsetY = 0;
         float textOffsetX = 0.0f;
@@ -4879,7 +7944,7 @@ static void GuiDrawText(const char *text, Rectangle textBounds, int alignment, C
         for (int c = 0, codepointSize = 0; c < lineSize; c += codepointSize)
         {
             int codepoint = GetCodepointNext(&lines[i][c], &codepointSize);
-            int index = GetGlyphIndex(guiFont, codepoint);
+            int index = GuiGetGlyphIndex(codepoint);
 
             // NOTE: Normally we exit the decoding sequence as soon as a bad byte is found (and return 0x3f)
             // but we need to draw all of the bad bytes using the '?' symbol moving one byte
@@ -4890,43 +7955,23 @@ static void GuiDrawText(const char *text, Rectangle textBounds, int alignment, C
             if (wrapMode == TEXT_WRAP_CHAR)
             {
                 // Get glyph width to check if it goes out of bounds
-                if (guiFont.glyphs[index].advanceX == 0) glyphWidth = ((float)guiFont.recs[index].width*scaleFactor);
-                else glyphWidth = (float)guiFont.glyphs[index].advanceX*scaleFactor;
+                glyphWidth = glyphAdvances[index];
 
                 // Jump to next line if current character reach end of the box limits
                 if ((textOffsetX + glyphWidth) > textBounds.width)
                 {
                     textOffsetX = 0.0f;
                     textOffsetY += GuiGetStyle(DEFAULT, TEXT_LINE_SPACING);
-
-                    if (tempWrapCharMode)   // Wrap at char level when too long words
-                    {
-                        wrapMode = TEXT_WRAP_WORD;
-                        tempWrapCharMode = false;
-                    }
                 }
             }
             else if (wrapMode == TEXT_WRAP_WORD)
             {
-                if (codepoint == 32) lastSpaceIndex = c;
-
-                // Get width to next space in line
-                int nextSpaceIndex = 0;
-                float nextSpaceWidth = GetNextSpaceWidth(lines[i] + c, &nextSpaceIndex);
-
-                int nextSpaceIndex2 = 0;
-                float nextWordSize = GetNextSpaceWidth(lines[i] + lastSpaceIndex + 1, &nextSpaceIndex2);
-
-                if (nextWordSize > textBounds.width)
-                {
-                    // Considering the case the next word is longer than bounds
-                    tempWrapCharMode = true;
-                    wrapMode = TEXT_WRAP_CHAR;
-                }
-                else if ((textOffsetX + nextSpaceWidth) > textBounds.width)
+                // Jump to next line if a line break is placed at current codepoint
+                if ((nextLineBreak < lineBreakCount) && (c >= lineBreaks[nextLineBreak]))
                 {
                     textOffsetX = 0.0f;
                     textOffsetY += GuiGetStyle(DEFAULT, TEXT_LINE_SPACING);
+                    nextLineBreak++;
                 }
             }
 
@@ -4942,7 +7987,7 @@ static void GuiDrawText(const char *text, Rectangle textBounds, int alignment, C
                         // Draw only required text glyphs fitting the textBounds.width
                         if (textOffsetX <= (textBounds.width - glyphWidth))
                         {
-                            DrawTextCodepoint(guiFont, codepoint, RAYGUI_CLITERAL(Vector2){ textBoundsPosition.x + textOffsetX, textBoundsPosition.y + textOffsetY }, (float)GuiGetStyle(DEFAULT, TEXT_SIZE), GuiFade(tint, guiAlpha));
+                            GuiDrawGlyph(index, RAYGUI_CLITERAL(Vector2){ textBoundsPosition.x + textOffsetX, textBoundsPosition.y + textOffsetY }, (float)GuiGetStyle(DEFAULT, TEXT_SIZE), tint);
                         }
                     }
                     else if ((wrapMode == TEXT_WRAP_CHAR) || (wrapMode == TEXT_WRAP_WORD))
@@ -4950,13 +7995,12 @@ static void GuiDrawText(const char *text, Rectangle textBounds, int alignment, C
                         // Draw only glyphs inside the bounds
                         if ((textBoundsPosition.y + textOffsetY) <= (textBounds.y + textBounds.height - GuiGetStyle(DEFAULT, TEXT_SIZE)))
                         {
-                            DrawTextCodepoint(guiFont, codepoint, RAYGUI_CLITERAL(Vector2){ textBoundsPosition.x + textOffsetX, textBoundsPosition.y + textOffsetY }, (float)GuiGetStyle(DEFAULT, TEXT_SIZE), GuiFade(tint, guiAlpha));
+                            GuiDrawGlyph(index, RAYGUI_CLITERAL(Vector2){ textBoundsPosition.x + textOffsetX, textBoundsPosition.y + textOffsetY }, (float)GuiGetStyle(DEFAULT, TEXT_SIZE), tint);
                         }
                     }
                 }
 
-                if (guiFont.glyphs[index].advanceX == 0) textOffsetX += ((float)guiFont.recs[index].width*scaleFactor + (float)GuiGetStyle(DEFAULT, TEXT_SPACING));
-                else textOffsetX += ((float)guiFont.glyphs[index].advanceX*scaleFactor + (float)GuiGetStyle(DEFAULT, TEXT_SPACING));
+                textOffsetX += (glyphAdvances[index] + (float)GuiGetStyle(DEFAULT, TEXT_SPACING));
             }
         }
 
@@ -4965,34 +8009,429 @@ static void GuiDrawText(const char *text, Rectangle textBounds, int alignment, C
         //---------------------------------------------------------------------------------
     }
 
+#if defined(RAYGUI_COMMAND_LIST)
+    GuiEndDrawItem();
+#endif
+
 #if defined(RAYGUI_DEBUG_TEXT_BOUNDS)
-    GuiDrawRectangle(textBounds, 0, WHITE, Fade(BLUE, 0.4f));
+    GuiDrawRectangle(textBounds, 0, WHITE, GuiFade(Fade(BLUE, 0.4f), guiAlpha));
 #endif
 }
 
 // Gui draw rectangle using default raygui plain style with borders
+// NOTE: Colors are expected to already include global alpha, see GuiGetStyleColor()
 static void GuiDrawRectangle(Rectangle rec, int borderWidth, Color borderColor, Color color)
 {
+#if defined(RAYGUI_COMMAND_LIST)
+    GuiBeginDrawItem(1, rec);
+#endif
+
     if (color.a > 0)
     {
         // Draw rectangle filled with color
-        DrawRectangle((int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, GuiFade(color, guiAlpha));
+        GuiDrawRectangleFill((int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, color);
     }
 
     if (borderWidth > 0)
     {
         // Draw rectangle border lines with color
-        DrawRectangle((int)rec.x, (int)rec.y, (int)rec.width, borderWidth, GuiFade(borderColor, guiAlpha));
-        DrawRectangle((int)rec.x, (int)rec.y + borderWidth, borderWidth, (int)rec.height - 2*borderWidth, GuiFade(borderColor, guiAlpha));
-        DrawRectangle((int)rec.x + (int)rec.width - borderWidth, (int)rec.y + borderWidth, borderWidth, (int)rec.height - 2*borderWidth, GuiFade(borderColor, guiAlpha));
-        DrawRectangle((int)rec.x, (int)rec.y + (int)rec.height - borderWidth, (int)rec.width, borderWidth, GuiFade(borderColor, guiAlpha));
+        GuiDrawRectangleFill((int)rec.x, (int)rec.y, (int)rec.width, borderWidth, borderColor);
+        GuiDrawRectangleFill((int)rec.x, (int)rec.y + borderWidth, borderWidth, (int)rec.height - 2*borderWidth, borderColor);
+        GuiDrawRectangleFill((int)rec.x + (int)rec.width - borderWidth, (int)rec.y + borderWidth, borderWidth, (int)rec.height - 2*borderWidth, borderColor);
+        GuiDrawRectangleFill((int)rec.x, (int)rec.y + (int)rec.height - borderWidth, (int)rec.width, borderWidth, borderColor);
     }
 
+#if defined(RAYGUI_COMMAND_LIST)
+    GuiEndDrawItem();
+#endif
+
 #if defined(RAYGUI_DEBUG_RECS_BOUNDS)
-    DrawRectangle((int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, Fade(RED, 0.4f));
+    GuiDrawRectangleFill((int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, Fade(RED, 0.4f));
+#endif
+}
+
+// Gui draw filled rectangle
+// NOTE: Color is expected to already include global alpha
+static void GuiDrawRectangleFill(int posX, int posY, int width, int height, Color color)
+{
+#if defined(RAYGUI_COMMAND_LIST)
+    GuiDrawCommand command = { 0 };
+    command.type = GUI_COMMAND_RECTANGLE;
+    command.rec = RAYGUI_CLITERAL(Rectangle){ (float)posX, (float)posY, (float)width, (float)height };
+    command.colors[0] = color;
+    GuiAddDrawCommand(command);
+#else
+    DrawRectangle(posX, posY, width, height, color);
+#endif
+}
+
+// Gui draw gradient rectangle, colors order: top-left, bottom-left, bottom-right, top-right
+// NOTE: Colors are expected to already include global alpha
+static void GuiDrawRectangleGradient(Rectangle rec, Color col1, Color col2, Color col3, Color col4)
+{
+#if defined(RAYGUI_COMMAND_LIST)
+    GuiDrawCommand command = { 0 };
+    command.type = GUI_COMMAND_RECTANGLE_GRADIENT;
+    command.rec = rec;
+    command.colors[0] = col1;
+    command.colors[1] = col2;
+    command.colors[2] = col3;
+    command.colors[3] = col4;
+    GuiAddDrawCommand(command);
+#else
+    DrawRectangleGradientEx(rec, col1, col2, col3, col4);
+#endif
+}
+
+// Gui draw one glyph using gui font
+// NOTE: Tint is expected to already include global alpha
+static void GuiDrawGlyph(int index, Vector2 position, float fontSize, Color tint)
+{
+#if defined(RAYGUI_COMMAND_LIST)
+    GuiDrawCommand command = { 0 };
+    command.type = GUI_COMMAND_GLYPH;
+    command.value = index;
+    command.size = fontSize;
+    command.rec = RAYGUI_CLITERAL(Rectangle){ position.x, position.y, GuiGetGlyphAdvances()[index], fontSize };
+    command.colors[0] = tint;
+    GuiAddDrawCommand(command);
+#else
+    GuiDrawGlyphTexture(index, position, fontSize, tint);
 #endif
 }
 
+// Gui draw one glyph quad from gui font atlas texture
+// NOTE: Same logic as raylib DrawTextCodepoint() but avoiding the glyph index search
+static void GuiDrawGlyphTexture(int index, Vector2 position, float fontSize, Color tint)
+{
+    float scaleFactor = fontSize/guiFont.baseSize;
+    float padding = (float)guiFont.glyphPadding;
+
+    Rectangle source = { guiFont.recs[index].x - padding, guiFont.recs[index].y - padding,
+        guiFont.recs[index].width + 2.0f*padding, guiFont.recs[index].height + 2.0f*padding };
+    Rectangle dest = { position.x + (guiFont.glyphs[index].offsetX - padding)*scaleFactor, position.y + (guiFont.glyphs[index].offsetY - padding)*scaleFactor,
+        source.width*scaleFactor, source.height*scaleFactor };
+
+    DrawTexturePro(guiFont.texture, source, dest, RAYGUI_CLITERAL(Vector2){ 0, 0 }, 0.0f, tint);
+}
+
+// Generate glyphs lookup table for gui font
+// NOTE: Glyph advances are scaled lazily, on first request for a different TEXT_SIZE
+static void GuiLoadGlyphTable(void)
+{
+    // Reuse font lookup table if available, otherwise replace one of the tables
+    int tableIndex = -1;
+
+    for (int i = 0; (i < RAYGUI_GLYPH_TABLE_CACHE_SIZE) && (tableIndex == -1); i++)
+    {
+        if (GuiIsGlyphTableFont(&guiGlyphTables[i], guiFont)) tableIndex = i;
+    }
+
+    if (tableIndex == -1)
+    {
+        tableIndex = guiGlyphTablesCounter%RAYGUI_GLYPH_TABLE_CACHE_SIZE;
+        guiGlyphTablesCounter++;
+    }
+
+    guiGlyphTable = &guiGlyphTables[tableIndex];
+
+    RAYGUI_FREE(guiGlyphTable->sparse);
+    RAYGUI_FREE(guiGlyphTable->advances);
+    memset(guiGlyphTable, 0, sizeof(GuiGlyphTable));
+
+    guiGlyphTable->glyphs = guiFont.glyphs;
+    guiGlyphTable->glyphCount = guiFont.glyphCount;
+    guiGlyphTable->textureId = guiFont.texture.id;
+    guiGlyphTable->baseSize = guiFont.baseSize;
+
+    // Font changed, cached text measures and layouts are not valid anymore
+    GuiResetTextCache();
+
+    if ((guiFont.glyphs == NULL) || (guiFont.glyphCount <= 0)) return;
+
+    // Get fallback glyph index, same logic as raylib GetGlyphIndex()
+    int sparseCount = 0;
+    for (int i = 0; i < guiFont.glyphCount; i++)
+    {
+        if (guiFont.glyphs[i].value == 63) guiGlyphTable->fallbackIndex = i;
+        if (guiFont.glyphs[i].value >= RAYGUI_GLYPH_TABLE_DENSE_SIZE) sparseCount++;
+    }
+
+    for (int i = 0; i < RAYGUI_GLYPH_TABLE_DENSE_SIZE; i++) guiGlyphTable->dense[i] = -1;
+
+    if (sparseCount > 0)
+    {
+        // NOTE: Hash capacity is kept at least at twice the codepoints count to keep probing short
+        guiGlyphTable->sparseCapacity = 16;
+        while (guiGlyphTable->sparseCapacity < 2*sparseCount) guiGlyphTable->sparseCapacity *= 2;
+
+        guiGlyphTable->sparse = (int *)RAYGUI_MALLOC(guiGlyphTable->sparseCapacity*2*sizeof(int));
+        for (int i = 0; i < guiGlyphTable->sparseCapacity; i++) guiGlyphTable->sparse[i*2] = -1;
+    }
+
+    for (int i = 0; i < guiFont.glyphCount; i++)
+    {
+        int codepoint = guiFont.glyphs[i].value;
+
+        // NOTE: In case of duplicated codepoints, first glyph is kept (same as raylib GetGlyphIndex())
+        if ((codepoint >= 0) && (codepoint < RAYGUI_GLYPH_TABLE_DENSE_SIZE))
+        {
+            if (guiGlyphTable->dense[codepoint] == -1) guiGlyphTable->dense[codepoint] = i;
+        }
+        else if (codepoint >= RAYGUI_GLYPH_TABLE_DENSE_SIZE)
+        {
+            unsigned int slot = ((unsigned int)codepoint*2654435761u) & (guiGlyphTable->sparseCapacity - 1);
+
+            while ((guiGlyphTable->sparse[slot*2] != -1) && (guiGlyphTable->sparse[slot*2] != codepoint)) slot = (slot + 1) & (guiGlyphTable->sparseCapacity - 1);
+
+            if (guiGlyphTable->sparse[slot*2] == -1)
+            {
+                guiGlyphTable->sparse[slot*2] = codepoint;
+                guiGlyphTable->sparse[slot*2 + 1] = i;
+            }
+        }
+    }
+
+    for (int i = 0; i < RAYGUI_GLYPH_TABLE_DENSE_SIZE; i++)
+    {
+        if (guiGlyphTable->dense[i] == -1) guiGlyphTable->dense[i] = guiGlyphTable->fallbackIndex;
+    }
+
+    guiGlyphTable->advances = (float *)RAYGUI_MALLOC(guiFont.glyphCount*sizeof(float));
+}
+
+// Select glyphs lookup table for gui font
+// NOTE: Lookup tables are kept for several fonts, switching style sets does not require regenerating them
+static void GuiSelectGlyphTable(void)
+{
+    for (int i = 0; i < RAYGUI_GLYPH_TABLE_CACHE_SIZE; i++)
+    {
+        if (GuiIsGlyphTableFont(&guiGlyphTables[i], guiFont))
+        {
+            guiGlyphTable = &guiGlyphTables[i];
+            return;
+        }
+    }
+
+    GuiLoadGlyphTable();
+}
+
+// Get glyph index for a codepoint in gui font
+// NOTE: Lookup table is regenerated if gui font has been changed without GuiSetFont()
+static int GuiGetGlyphIndex(int codepoint)
+{
+    if (!GuiIsGlyphTableFont(guiGlyphTable, guiFont)) GuiSelectGlyphTable();
+
+    if ((codepoint >= 0) && (codepoint < RAYGUI_GLYPH_TABLE_DENSE_SIZE)) return guiGlyphTable->dense[codepoint];
+
+    if (guiGlyphTable->sparse != NULL)
+    {
+        unsigned int slot = ((unsigned int)codepoint*2654435761u) & (guiGlyphTable->sparseCapacity - 1);
+
+        while (guiGlyphTable->sparse[slot*2] != -1)
+        {
+            if (guiGlyphTable->sparse[slot*2] == codepoint) return guiGlyphTable->sparse[slot*2 + 1];
+            slot = (slot + 1) & (guiGlyphTable->sparseCapacity - 1);
+        }
+    }
+
+    return guiGlyphTable->fallbackIndex;
+}
+
+// Check if glyphs lookup table was generated for font
+static bool GuiIsGlyphTableFont(const GuiGlyphTable *table, Font font)
+{
+    return ((table->glyphs == font.glyphs) && (table->glyphCount == font.glyphCount) &&
+            (table->textureId == font.texture.id) && (table->baseSize == font.baseSize));
+}
+
+// Get gui font glyphs advances, scaled for current TEXT_SIZE
+// NOTE: Glyph advance is glyph advanceX or glyph rectangle width if no advanceX defined
+static const float *GuiGetGlyphAdvances(void)
+{
+    int textSize = GuiGetStyle(DEFAULT, TEXT_SIZE);
+
+    if (!GuiIsGlyphTableFont(guiGlyphTable, guiFont)) GuiSelectGlyphTable();
+
+    if ((guiGlyphTable->textSize != textSize) && (guiGlyphTable->advances != NULL))
+    {
+        float scaleFactor = (float)textSize/guiFont.baseSize;
+
+        for (int i = 0; i < guiFont.glyphCount; i++)
+        {
+            if (guiFont.glyphs[i].advanceX == 0) guiGlyphTable->advances[i] = (float)guiFont.recs[i].width*scaleFactor;
+            else guiGlyphTable->advances[i] = (float)guiFont.glyphs[i].advanceX*scaleFactor;
+        }
+
+        guiGlyphTable->textSize = textSize;
+    }
+
+    return guiGlyphTable->advances;
+}
+
+#if defined(RAYGUI_COMMAND_LIST)
+// Add draw command to list
+// NOTE: If list is full, recorded commands are submitted first, whole frame is damaged
+static void GuiAddDrawCommand(GuiDrawCommand command)
+{
+    if (guiDrawCommandCount >= RAYGUI_MAX_DRAW_COMMANDS)
+    {
+        RAYGUI_LOG("WARNING: Draw commands list is full, commands submitted before GuiFlush() call\n");
+        GuiFlush();
+
+        // Commands submitted are not clipped to damaged regions
+        guiDamageFull = true;
+    }
+
+    guiDrawCommands[guiDrawCommandCount] = command;
+    guiDrawCommandCount++;
+
+    if (!guiDamageTracking) return;
+
+    // Draw command tracked into active draw item, or into its own item
+    bool single = (guiDrawItemActive == NULL);
+    if (single) GuiBeginDrawItem(2 + command.type, command.rec);
+
+    GuiDrawItem *item = guiDrawItemActive;
+    Rectangle bounds = command.rec;
+
+    if (command.type == GUI_COMMAND_GLYPH)
+    {
+        // Glyph quad bounds, same as GuiDrawGlyphTexture(), font is included in content
+        float scaleFactor = command.size/guiFont.baseSize;
+        float padding = (float)guiFont.glyphPadding;
+
+        bounds.x = command.rec.x + (guiFont.glyphs[command.value].offsetX - padding)*scaleFactor;
+        bounds.y = command.rec.y + (guiFont.glyphs[command.value].offsetY - padding)*scaleFactor;
+        bounds.width = (guiFont.recs[command.value].width + 2.0f*padding)*scaleFactor;
+        bounds.height = (guiFont.recs[command.value].height + 2.0f*padding)*scaleFactor;
+
+        item->hash = GuiHashData(&guiFont.texture.id, sizeof(unsigned int), item->hash);
+    }
+
+    item->hash = GuiHashData(&command, sizeof(GuiDrawCommand), item->hash);
+
+    if ((bounds.width > 0) && (bounds.height > 0))
+    {
+        // Bounds aligned to pixels covered
+        float x0 = floorf(bounds.x);
+        float y0 = floorf(bounds.y);
+        float x1 = ceilf(bounds.x + bounds.width);
+        float y1 = ceilf(bounds.y + bounds.height);
+
+        if ((item->bounds.width > 0) && (item->bounds.height > 0))
+        {
+            x0 = fminf(x0, item->bounds.x);
+            y0 = fminf(y0, item->bounds.y);
+            x1 = fmaxf(x1, item->bounds.x + item->bounds.width);
+            y1 = fmaxf(y1, item->bounds.y + item->bounds.height);
+        }
+
+        item->bounds = RAYGUI_CLITERAL(Rectangle){ x0, y0, x1 - x0, y1 - y0 };
+    }
+
+    if (single) GuiEndDrawItem();
+}
+
+// Begin draw item, following commands are tracked into it until GuiEndDrawItem()
+// NOTE: Item content hash starts from previous item identity, so drawing order changes are detected
+static void GuiBeginDrawItem(int kind, Rectangle rec)
+{
+    if (!guiDamageTracking) return;
+
+    int count = guiDrawItemCount[guiDrawItemFrame];
+
+    if (count >= RAYGUI_MAX_DRAW_ITEMS)
+    {
+        // Whole frame damaged, last item bounds grown with remaining commands
+        guiDrawItemActive = &guiDrawItems[guiDrawItemFrame][RAYGUI_MAX_DRAW_ITEMS - 1];
+        guiDamageFull = true;
+        return;
+    }
+
+    GuiDrawItem *item = &guiDrawItems[guiDrawItemFrame][count];
+    item->key = GuiHashData(&kind, sizeof(int), RAYGUI_HASH_SEED);
+    item->key = GuiHashData(&rec, sizeof(Rectangle), item->key);
+    item->hash = (count > 0)? guiDrawItems[guiDrawItemFrame][count - 1].key : RAYGUI_HASH_SEED;
+    item->bounds = RAYGUI_CLITERAL(Rectangle){ 0, 0, 0, 0 };
+    item->matched = false;
+
+    guiDrawItemCount[guiDrawItemFrame]++;
+    guiDrawItemActive = item;
+}
+
+// End draw item
+static void GuiEndDrawItem(void)
+{
+    guiDrawItemActive = NULL;
+}
+
+// Add damaged rectangle, merged with overlapping ones
+// NOTE: Rectangles are integer aligned and kept not overlapping, so every pixel is redrawn once,
+// if list is full, rectangle is merged with the one with smallest resulting area
+static void GuiAddDamageRec(Rectangle rec)
+{
+    if ((rec.width <= 0) || (rec.height <= 0)) return;
+
+    for (int i = 0; i < guiDamageRecCount; i++)
+    {
+        Rectangle other = guiDamageRecs[i];
+
+        if ((rec.x < (other.x + other.width)) && (other.x < (rec.x + rec.width)) &&
+            (rec.y < (other.y + other.height)) && (other.y < (rec.y + rec.height)))
+        {
+            // Overlapping rectangle removed and merged, merged rectangle could overlap previous ones
+            float x1 = fmaxf(rec.x + rec.width, other.x + other.width);
+            float y1 = fmaxf(rec.y + rec.height, other.y + other.height);
+            rec.x = fminf(rec.x, other.x);
+            rec.y = fminf(rec.y, other.y);
+            rec.width = x1 - rec.x;
+            rec.height = y1 - rec.y;
+
+            guiDamageRecs[i] = guiDamageRecs[guiDamageRecCount - 1];
+            guiDamageRecCount--;
+            i = -1;
+        }
+    }
+
+    if (guiDamageRecCount < RAYGUI_MAX_DAMAGE_RECS)
+    {
+        guiDamageRecs[guiDamageRecCount] = rec;
+        guiDamageRecCount++;
+    }
+    else
+    {
+        int best = 0;
+        float bestArea = 0.0f;
+
+        for (int i = 0; i < guiDamageRecCount; i++)
+        {
+            Rectangle other = guiDamageRecs[i];
+            float area = (fmaxf(rec.x + rec.width, other.x + other.width) - fminf(rec.x, other.x))*
+                         (fmaxf(rec.y + rec.height, other.y + other.height) - fminf(rec.y, other.y));
+
+            if ((i == 0) || (area < bestArea))
+            {
+                best = i;
+                bestArea = area;
+            }
+        }
+
+        Rectangle other = guiDamageRecs[best];
+        float x1 = fmaxf(rec.x + rec.width, other.x + other.width);
+        float y1 = fmaxf(rec.y + rec.height, other.y + other.height);
+        Rectangle merged = { fminf(rec.x, other.x), fminf(rec.y, other.y), 0, 0 };
+        merged.width = x1 - merged.x;
+        merged.height = y1 - merged.y;
+
+        guiDamageRecs[best] = guiDamageRecs[guiDamageRecCount - 1];
+        guiDamageRecCount--;
+
+        GuiAddDamageRec(merged);
+    }
+}
+#endif
+
 // Draw tooltip using control bounds
 static void GuiTooltip(Rectangle controlRec)
 {
@@ -5004,13 +8443,11 @@ static void GuiTooltip(Rectangle controlRec)
 
         GuiPanel(RAYGUI_CLITERAL(Rectangle){ controlRec.x, controlRec.y + controlRec.height + 4, textSize.x + 16, GuiGetStyle(DEFAULT, TEXT_SIZE) + 8.f }, NULL);
 
-        int textPadding = GuiGetStyle(LABEL, TEXT_PADDING);
-        int textAlignment = GuiGetStyle(LABEL, TEXT_ALIGNMENT);
-        GuiSetStyle(LABEL, TEXT_PADDING, 0);
-        GuiSetStyle(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
+        GuiPushStyle(LABEL, TEXT_PADDING, 0);
+        GuiPushStyle(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
         GuiLabel(RAYGUI_CLITERAL(Rectangle){ controlRec.x, controlRec.y + controlRec.height + 4, textSize.x + 16, GuiGetStyle(DEFAULT, TEXT_SIZE) + 8.f }, guiTooltipPtr);
-        GuiSetStyle(LABEL, TEXT_ALIGNMENT, textAlignment);
-        GuiSetStyle(LABEL, TEXT_PADDING, textPadding);
+        GuiPopStyle();
+        GuiPopStyle();
     }
 }
 
@@ -5334,10 +8771,10 @@ static int GuiScrollBar(Rectangle bounds, int value, int minValue, int maxValue)
 
     // Draw control
     //--------------------------------------------------------------------
-    GuiDrawRectangle(bounds, GuiGetStyle(SCROLLBAR, BORDER_WIDTH), GetColor(GuiGetStyle(LISTVIEW, BORDER + state*3)), GetColor(GuiGetStyle(DEFAULT, BORDER_COLOR_DISABLED)));   // Draw the background
+    GuiDrawRectangle(bounds, GuiGetStyle(SCROLLBAR, BORDER_WIDTH), GuiGetStyleColor(LISTVIEW, BORDER + state*3), GuiGetStyleColor(DEFAULT, BORDER_COLOR_DISABLED));   // Draw the background
 
-    GuiDrawRectangle(scrollbar, 0, BLANK, GetColor(GuiGetStyle(BUTTON, BASE_COLOR_NORMAL)));     // Draw the scrollbar active area background
-    GuiDrawRectangle(slider, 0, BLANK, GetColor(GuiGetStyle(SLIDER, BORDER + state*3)));         // Draw the slider bar
+    GuiDrawRectangle(scrollbar, 0, BLANK, GuiGetStyleColor(BUTTON, BASE_COLOR_NORMAL));     // Draw the scrollbar active area background
+    GuiDrawRectangle(slider, 0, BLANK, GuiGetStyleColor(SLIDER, BORDER + state*3));         // Draw the slider bar
 
     // Draw arrows (using icon if available)
     if (GuiGetStyle(SCROLLBAR, ARROWS_VISIBLE))
@@ -5345,17 +8782,17 @@ static int GuiScrollBar(Rectangle bounds, int value, int minValue, int maxValue)
 #if defined(RAYGUI_NO_ICONS)
         GuiDrawText(isVertical? "^" : "<",
             RAYGUI_CLITERAL(Rectangle){ arrowUpLeft.x, arrowUpLeft.y, isVertical? bounds.width : bounds.height, isVertical? bounds.width : bounds.height },
-            TEXT_ALIGN_CENTER, GetColor(GuiGetStyle(DROPDOWNBOX, TEXT + (state*3))));
+            TEXT_ALIGN_CENTER, GuiGetStyleColor(DROPDOWNBOX, TEXT + (state*3)));
         GuiDrawText(isVertical? "v" : ">",
             RAYGUI_CLITERAL(Rectangle){ arrowDownRight.x, arrowDownRight.y, isVertical? bounds.width : bounds.height, isVertical? bounds.width : bounds.height },
-            TEXT_ALIGN_CENTER, GetColor(GuiGetStyle(DROPDOWNBOX, TEXT + (state*3))));
+            TEXT_ALIGN_CENTER, GuiGetStyleColor(DROPDOWNBOX, TEXT + (state*3)));
 #else
         GuiDrawText(isVertical? "#121#" : "#118#",
             RAYGUI_CLITERAL(Rectangle){ arrowUpLeft.x, arrowUpLeft.y, isVertical? bounds.width : bounds.height, isVertical? bounds.width : bounds.height },
-            TEXT_ALIGN_CENTER, GetColor(GuiGetStyle(SCROLLBAR, TEXT + state*3)));   // ICON_ARROW_UP_FILL / ICON_ARROW_LEFT_FILL
+            TEXT_ALIGN_CENTER, GuiGetStyleColor(SCROLLBAR, TEXT + state*3));   // ICON_ARROW_UP_FILL / ICON_ARROW_LEFT_FILL
         GuiDrawText(isVertical? "#120#" : "#119#",
             RAYGUI_CLITERAL(Rectangle){ arrowDownRight.x, arrowDownRight.y, isVertical? bounds.width : bounds.height, isVertical? bounds.width : bounds.height },
-            TEXT_ALIGN_CENTER, GetColor(GuiGetStyle(SCROLLBAR, TEXT + state*3)));   // ICON_ARROW_DOWN_FILL / ICON_ARROW_RIGHT_FILL
+            TEXT_ALIGN_CENTER, GuiGetStyleColor(SCROLLBAR, TEXT + state*3));   // ICON_ARROW_DOWN_FILL / ICON_ARROW_RIGHT_FILL
 #endif
     }
     //--------------------------------------------------------------------
@@ -5423,14 +8860,6 @@ static const char *TextFormat(const char *text, ...)
     return buffer;
 }
 
-// Draw rectangle with vertical gradient fill color
-// NOTE: This function is only used by GuiColorPicker()
-static void DrawRectangleGradientV(int posX, int posY, int width, int height, Color color1, Color color2)
-{
-    Rectangle bounds = { (float)posX, (float)posY, (float)width, (float)height };
-    DrawRectangleGradientEx(bounds, color1, color2, color2, color1);
-}
-
 // Split string into multiple strings
 const char **TextSplit(const char *text, char delimiter, int *count)
 {
@@ -5574,9 +9003,41 @@ static int GetCodepointNext(const char *text, int *codepointSize)
         *codepointSize = 1;
     }
 
+    return codepoint;
+}
+
+// Get previous codepoint in a UTF-8 encoded text, scanning until '\0' is found
+// When a invalid UTF-8 byte is encountered we exit as soon as possible and a '?'(0x3f) codepoint is returned
+// Total number of bytes processed are returned as a parameter
+static int GetCodepointPrevious(const char *text, int *codepointSize)
+{
+    const char *ptr = text;
+    int codepoint = 0x3f;       // Codepoint (defaults to '?')
+    int cpSize = 0;
+    *codepointSize = 0;
+
+    // Move to previous codepoint
+    do ptr--;
+    while (((0x80 & ptr[0]) != 0) && ((0xc0 & ptr[0]) ==  0x80));
+
+    codepoint = GetCodepointNext(ptr, &cpSize);
+
+    if (codepoint != 0) *codepointSize = cpSize;
 
     return codepoint;
 }
+
+// Get color with alpha applied, alpha goes from 0.0f to 1.0f
+// NOTE: Same as raylib Fade(), color alpha is replaced, GuiFade() scales it
+static Color Fade(Color color, float alpha)
+{
+    if (alpha < 0.0f) alpha = 0.0f;
+    else if (alpha > 1.0f) alpha = 1.0f;
+
+    Color result = { color.r, color.g, color.b, (unsigned char)(255.0f*alpha) };
+
+    return result;
+}
 #endif      // RAYGUI_STANDALONE
 
 #endif      // RAYGUI_IMPLEMENTATION